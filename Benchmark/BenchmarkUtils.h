@@ -0,0 +1,121 @@
+/**
+ * @filename BenchmarkUtils.h
+ * @description Benchmark timing, random key and latency statistics helpers
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#ifndef BENCHMARKUTILS_H
+#define BENCHMARKUTILS_H
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+/* 单调时钟, 单位纳秒 */
+static inline long long benchNowNs(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER counter;
+    if (!freq.QuadPart) QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (long long) ((double) counter.QuadPart * 1e9 / (double) freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long) ts.tv_sec * 1000000000LL + ts.tv_nsec;
+#endif
+}
+
+/* xorshift伪随机数, 同一种子在各平台上产生相同的序列 */
+static inline unsigned int benchRandom(unsigned int *state)
+{
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+
+    return x;
+}
+
+/* 生成[0, n)的随机排列 */
+static inline int *benchPermutation(int n, unsigned int *state)
+{
+    int *keys = (int *) malloc(sizeof(int) * (n > 0 ? n : 1));
+    int i;
+
+    for (i = 0; i < n; i++) keys[i] = i;
+    for (i = n - 1; i > 0; i--) {
+        int j = (int) (benchRandom(state) % (unsigned int) (i + 1));
+        int temp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = temp;
+    }
+
+    return keys;
+}
+
+/* Zipf分布生成器(Gray等人的方法), 排名0最热 */
+typedef struct BenchZipf {
+    int n;
+    double theta, alpha, zetan, eta;
+} BenchZipf;
+
+static inline void benchZipfInit(BenchZipf *zipf, int n, double theta)
+{
+    double zeta2 = 1.0 + pow(0.5, theta);
+    int i;
+
+    zipf->n = n;
+    zipf->theta = theta;
+    zipf->alpha = 1.0 / (1.0 - theta);
+    zipf->zetan = 0;
+    for (i = 1; i <= n; i++) zipf->zetan += 1.0 / pow((double) i, theta);
+    zipf->eta = (1.0 - pow(2.0 / n, 1.0 - theta)) / (1.0 - zeta2 / zipf->zetan);
+}
+
+static inline int benchZipfNext(BenchZipf *zipf, unsigned int *state)
+{
+    double u = (double) benchRandom(state) / 4294967296.0;
+    double uz = u * zipf->zetan;
+    int rank;
+
+    if (uz < 1.0) return 0;
+    if (uz < 1.0 + pow(0.5, zipf->theta)) return 1;
+    rank = (int) (zipf->n * pow(zipf->eta * u - zipf->eta + 1.0, zipf->alpha));
+
+    return rank < zipf->n ? rank : zipf->n - 1;
+}
+
+static inline int benchCompareLongLong(const void *a, const void *b)
+{
+    long long x = *(const long long *) a, y = *(const long long *) b;
+
+    return (x > y) - (x < y);
+}
+
+/* 取延迟样本的分位数, samples必须已由benchSortSamples排序 */
+static inline long long benchPercentile(const long long *samples, long count, double percent)
+{
+    long index;
+
+    if (count <= 0) return 0;
+    index = (long) ceil(percent / 100.0 * count) - 1;
+    if (index < 0) index = 0;
+
+    return samples[index];
+}
+
+static inline void benchSortSamples(long long *samples, long count)
+{
+    qsort(samples, (size_t) count, sizeof(long long), benchCompareLongLong);
+}
+
+#endif /* BENCHMARKUTILS_H */
@@ -0,0 +1,203 @@
+/**
+ * @filename CombiningBenchmark.c
+ * @description Write-heavy throughput scaling benchmark of the flat-combining Red-Black tree
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 用法: CombiningBenchmark [-n count] [-t maxThreads] [-d milliseconds] [-r readPercent] [-s seed]
+ * 线程数从1开始倍增到maxThreads(默认64), 每个线程数分别测量三种模式:
+ * mutex为全局互斥锁, rwlock为读写锁(查找取读锁), combining为平面合并.
+ * 每个线程随机插入或删除[0, 2count)中的键, 另有readPercent%的操作为查找.
+ * 每次测量输出一行CSV, avg_batch为平面合并每趟平均执行的操作数.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "BenchmarkUtils.h"
+#include "../HeaderFiles/CombiningRBTree.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+/* 测量模式 */
+typedef enum {
+    BENCH_MUTEX = 0,
+    BENCH_RWLOCK = 1,
+    BENCH_COMBINING = 2
+} BenchMode;
+
+static const char *modeNames[] = {"mutex", "rwlock", "combining"};
+
+/* 一次测量中所有线程共享的状态 */
+typedef struct BenchShared {
+    BenchMode mode;
+    int count;                 /* 预先插入的键数, 键的范围为[0, 2count) */
+    int readPercent;           /* 查找操作的百分比 */
+    int start;                 /* 线程同时开始的信号 */
+    int stop;                  /* 线程结束的信号 */
+    RBRoot *root;              /* mutex和rwlock模式的红黑树 */
+    pthread_mutex_t lock;      /* mutex模式的全局锁 */
+    pthread_rwlock_t rwlock;   /* rwlock模式的读写锁 */
+    CombiningRBTree *tree;     /* combining模式的红黑树 */
+} BenchShared;
+
+/* 单个线程的参数和结果 */
+typedef struct BenchThread {
+    BenchShared *shared;
+    pthread_t thread;
+    unsigned int seed;
+    long long ops;
+    char pad[64];              /* 避免相邻线程的计数器伪共享 */
+} BenchThread;
+
+static void benchSleepMs(int milliseconds)
+{
+#ifdef _WIN32
+    Sleep((DWORD) milliseconds);
+#else
+    usleep((useconds_t) milliseconds * 1000);
+#endif
+}
+
+static void *workerMain(void *arg)
+{
+    BenchThread *self = (BenchThread *) arg;
+    BenchShared *shared = self->shared;
+    int thread = shared->mode == BENCH_COMBINING ? registerCombiningRBTreeThread(shared->tree) : 0;
+    long long ops = 0;
+
+    while (!__atomic_load_n(&shared->start, __ATOMIC_ACQUIRE));
+    while (!__atomic_load_n(&shared->stop, __ATOMIC_RELAXED)) {
+        int i;
+        for (i = 0; i < 64; i++) {
+            unsigned int r = benchRandom(&self->seed);
+            int x = (int) (benchRandom(&self->seed) % (unsigned int) (shared->count * 2));
+            int op = (int) (r % 100) < shared->readPercent ? 0 : (r >> 8) & 1 ? 1 : 2;
+
+            switch (shared->mode) {
+                case BENCH_MUTEX:
+                    pthread_mutex_lock(&shared->lock);
+                    if (op == 0) searchRBTreeNode(shared->root, x);
+                    else if (op == 1) insertRBTree(shared->root, x);
+                    else deleteRBTree(shared->root, x);
+                    pthread_mutex_unlock(&shared->lock);
+                    break;
+                case BENCH_RWLOCK:
+                    if (op == 0) {
+                        pthread_rwlock_rdlock(&shared->rwlock);
+                        searchRBTreeNode(shared->root, x);
+                    } else {
+                        pthread_rwlock_wrlock(&shared->rwlock);
+                        if (op == 1) insertRBTree(shared->root, x);
+                        else deleteRBTree(shared->root, x);
+                    }
+                    pthread_rwlock_unlock(&shared->rwlock);
+                    break;
+                default:
+                    if (op == 0) searchCombiningRBTree(shared->tree, thread, x);
+                    else if (op == 1) insertCombiningRBTree(shared->tree, thread, x);
+                    else deleteCombiningRBTree(shared->tree, thread, x);
+                    break;
+            }
+        }
+        ops += 64;
+    }
+    self->ops = ops;
+
+    return NULL;
+}
+
+/* 运行一次测量并输出一行CSV */
+static void runBenchmark(BenchMode mode, int count, int threadCount, int readPercent, int milliseconds,
+                         unsigned int seed)
+{
+    BenchShared shared;
+    BenchThread *threads = (BenchThread *) calloc((size_t) threadCount, sizeof(BenchThread));
+    int *keys = (int *) malloc(sizeof(int) * count);
+    RBRoot *root;
+    long long begin, elapsed, ops = 0;
+    double batch = 1.0;
+    int i;
+
+    memset(&shared, 0, sizeof(shared));
+    shared.mode = mode;
+    shared.count = count;
+    shared.readPercent = readPercent;
+    /* 三种模式都由同一个有序数组构建, 键为0, 2, 4, ..., 插入和删除大致各占一半 */
+    for (i = 0; i < count; i++) keys[i] = i * 2;
+    if (mode == BENCH_COMBINING) {
+        shared.tree = createCombiningRBTree(NULL);
+        root = shared.tree->root;
+    } else {
+        root = shared.root = createRBTree();
+        pthread_mutex_init(&shared.lock, NULL);
+        pthread_rwlock_init(&shared.rwlock, NULL);
+    }
+    buildRBTreeFromSorted(root, keys, count);
+    free(keys);
+
+    for (i = 0; i < threadCount; i++) {
+        threads[i].shared = &shared;
+        threads[i].seed = seed + (unsigned int) i * 7919u;
+        pthread_create(&threads[i].thread, NULL, workerMain, &threads[i]);
+    }
+
+    begin = benchNowNs();
+    __atomic_store_n(&shared.start, 1, __ATOMIC_RELEASE);
+    benchSleepMs(milliseconds);
+    __atomic_store_n(&shared.stop, 1, __ATOMIC_RELAXED);
+    for (i = 0; i < threadCount; i++) {
+        pthread_join(threads[i].thread, NULL);
+        ops += threads[i].ops;
+    }
+    elapsed = benchNowNs() - begin;
+
+    if (mode == BENCH_COMBINING) {
+        if (shared.tree->passes) batch = (double) shared.tree->combined / (double) shared.tree->passes;
+        destroyCombiningRBTree(shared.tree);
+    } else {
+        destroyRBTree(shared.root);
+        pthread_mutex_destroy(&shared.lock);
+        pthread_rwlock_destroy(&shared.rwlock);
+    }
+
+    printf("%s,%d,%d,%lld,%.6f,%.0f,%.2f\n", modeNames[mode], threadCount, readPercent, ops, elapsed / 1e9,
+           ops / (elapsed / 1e9), batch);
+    fflush(stdout);
+    free(threads);
+}
+
+int main(int argc, char *argv[])
+{
+    int count = 100000, maxThreads = 64, milliseconds = 500, readPercent = 0, threads, i;
+    unsigned int seed = 20201218;
+
+    for (i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "-n")) count = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-t")) maxThreads = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-d")) milliseconds = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-r")) readPercent = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-s")) seed = (unsigned int) strtoul(argv[i + 1], NULL, 10);
+        else {
+            fprintf(stderr, "usage: %s [-n count] [-t maxThreads] [-d milliseconds] [-r readPercent] [-s seed]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+    if (count <= 0 || maxThreads <= 0 || milliseconds <= 0 || readPercent < 0 || readPercent > 100) return 1;
+    if (maxThreads > RBTREE_COMBINING_MAX_THREADS) maxThreads = RBTREE_COMBINING_MAX_THREADS;
+
+    printf("mode,threads,read_pct,ops,seconds,ops_per_sec,avg_batch\n");
+    for (threads = 1;; threads *= 2) {
+        if (threads > maxThreads) threads = maxThreads;
+        runBenchmark(BENCH_MUTEX, count, threads, readPercent, milliseconds, seed);
+        runBenchmark(BENCH_RWLOCK, count, threads, readPercent, milliseconds, seed);
+        runBenchmark(BENCH_COMBINING, count, threads, readPercent, milliseconds, seed);
+        if (threads == maxThreads) break;
+    }
+
+    return 0;
+}
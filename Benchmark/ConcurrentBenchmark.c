@@ -0,0 +1,198 @@
+/**
+ * @filename ConcurrentBenchmark.c
+ * @description Read throughput scaling benchmark of the concurrent Red-Black tree
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 用法: ConcurrentBenchmark [-n count] [-t maxReaders] [-d milliseconds] [-W 0|1] [-s seed]
+ * 读者线程数从1开始倍增到maxReaders, 每个线程数分别测量两种模式:
+ * mutex为以全局互斥锁包装普通红黑树的所有操作, epoch为单写者加无锁读者.
+ * -W 1(默认)时另有一个写者线程持续删除并重新插入随机键.
+ * 每次测量输出一行CSV, 一半查找命中, 一半未命中.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "BenchmarkUtils.h"
+#include "../HeaderFiles/ConcurrentRBTree.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+/* 一次测量中所有线程共享的状态 */
+typedef struct BenchShared {
+    int epochMode;             /* 1为无锁读者, 0为全局互斥锁 */
+    int count;                 /* 树中的键数, 键为0, 2, 4, ... */
+    int start;                 /* 线程同时开始的信号 */
+    int stop;                  /* 线程结束的信号 */
+    RBRoot *root;              /* mutex模式的红黑树 */
+    pthread_mutex_t lock;      /* mutex模式的全局锁 */
+    ConcurrentRBTree *tree;    /* epoch模式的红黑树 */
+} BenchShared;
+
+/* 单个线程的参数和结果 */
+typedef struct BenchThread {
+    BenchShared *shared;
+    pthread_t thread;
+    unsigned int seed;
+    long long ops;
+    char pad[64];              /* 避免相邻线程的计数器伪共享 */
+} BenchThread;
+
+static void benchSleepMs(int milliseconds)
+{
+#ifdef _WIN32
+    Sleep((DWORD) milliseconds);
+#else
+    usleep((useconds_t) milliseconds * 1000);
+#endif
+}
+
+static void waitStart(BenchShared *shared)
+{
+    while (!__atomic_load_n(&shared->start, __ATOMIC_ACQUIRE));
+}
+
+static void *readerMain(void *arg)
+{
+    BenchThread *self = (BenchThread *) arg;
+    BenchShared *shared = self->shared;
+    int reader = shared->epochMode ? registerConcurrentRBTreeReader(shared->tree) : 0;
+    long long ops = 0;
+
+    waitStart(shared);
+    while (!__atomic_load_n(&shared->stop, __ATOMIC_RELAXED)) {
+        int i;
+        for (i = 0; i < 64; i++) {
+            int x = (int) (benchRandom(&self->seed) % (unsigned int) (shared->count * 2));
+            if (shared->epochMode) searchConcurrentRBTree(shared->tree, reader, x);
+            else {
+                pthread_mutex_lock(&shared->lock);
+                searchRBTreeNode(shared->root, x);
+                pthread_mutex_unlock(&shared->lock);
+            }
+        }
+        ops += 64;
+    }
+    self->ops = ops;
+
+    return NULL;
+}
+
+static void *writerMain(void *arg)
+{
+    BenchThread *self = (BenchThread *) arg;
+    BenchShared *shared = self->shared;
+    long long ops = 0;
+
+    waitStart(shared);
+    while (!__atomic_load_n(&shared->stop, __ATOMIC_RELAXED)) {
+        int x = (int) (benchRandom(&self->seed) % (unsigned int) shared->count) * 2;
+        if (shared->epochMode) {
+            deleteConcurrentRBTree(shared->tree, x);
+            insertConcurrentRBTree(shared->tree, x);
+        } else {
+            pthread_mutex_lock(&shared->lock);
+            deleteRBTree(shared->root, x);
+            pthread_mutex_unlock(&shared->lock);
+            pthread_mutex_lock(&shared->lock);
+            insertRBTree(shared->root, x);
+            pthread_mutex_unlock(&shared->lock);
+        }
+        ops += 2;
+    }
+    self->ops = ops;
+
+    return NULL;
+}
+
+/* 运行一次测量并输出一行CSV */
+static void runBenchmark(int epochMode, int count, int readers, int writer, int milliseconds, unsigned int seed)
+{
+    BenchShared shared;
+    BenchThread *threads = (BenchThread *) calloc((size_t) readers + 1, sizeof(BenchThread));
+    int *keys = (int *) malloc(sizeof(int) * count);
+    long long begin, elapsed, reads = 0;
+    int i;
+
+    memset(&shared, 0, sizeof(shared));
+    shared.epochMode = epochMode;
+    shared.count = count;
+    /* 两种模式都由有序数组构建, 结点布局相同 */
+    for (i = 0; i < count; i++) keys[i] = i * 2;
+    if (epochMode) {
+        shared.tree = createConcurrentRBTree(NULL);
+        buildRBTreeFromSorted(shared.tree->root, keys, count);
+    } else {
+        shared.root = createRBTree();
+        buildRBTreeFromSorted(shared.root, keys, count);
+        pthread_mutex_init(&shared.lock, NULL);
+    }
+    free(keys);
+
+    for (i = 0; i <= readers; i++) {
+        threads[i].shared = &shared;
+        threads[i].seed = seed + (unsigned int) i * 7919u;
+        if (i < readers) pthread_create(&threads[i].thread, NULL, readerMain, &threads[i]);
+        else if (writer) pthread_create(&threads[i].thread, NULL, writerMain, &threads[i]);
+    }
+
+    begin = benchNowNs();
+    __atomic_store_n(&shared.start, 1, __ATOMIC_RELEASE);
+    benchSleepMs(milliseconds);
+    __atomic_store_n(&shared.stop, 1, __ATOMIC_RELAXED);
+    for (i = 0; i <= readers; i++) {
+        if (i < readers || writer) pthread_join(threads[i].thread, NULL);
+        if (i < readers) reads += threads[i].ops;
+    }
+    elapsed = benchNowNs() - begin;
+
+    printf("%s,%d,%d,%.6f,%lld,%.0f,%.0f\n", epochMode ? "epoch" : "mutex", readers, writer,
+           elapsed / 1e9, reads, reads / (elapsed / 1e9), threads[readers].ops / (elapsed / 1e9));
+    fflush(stdout);
+
+    if (epochMode) destroyConcurrentRBTree(shared.tree);
+    else {
+        destroyRBTree(shared.root);
+        pthread_mutex_destroy(&shared.lock);
+    }
+    free(threads);
+}
+
+int main(int argc, char *argv[])
+{
+    int count = 1000000, maxReaders = 8, milliseconds = 500, writer = 1, readers, i;
+    unsigned int seed = 20201218;
+
+#ifndef _WIN32
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus > 0) maxReaders = (int) cpus;
+#endif
+
+    for (i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "-n")) count = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-t")) maxReaders = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-d")) milliseconds = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-W")) writer = atoi(argv[i + 1]) != 0;
+        else if (!strcmp(argv[i], "-s")) seed = (unsigned int) strtoul(argv[i + 1], NULL, 10);
+        else {
+            fprintf(stderr, "usage: %s [-n count] [-t maxReaders] [-d milliseconds] [-W 0|1] [-s seed]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (count <= 0 || maxReaders <= 0 || milliseconds <= 0) return 1;
+    if (maxReaders > RBTREE_MAX_READERS) maxReaders = RBTREE_MAX_READERS;
+
+    printf("mode,readers,writer,seconds,reads,reads_per_sec,writes_per_sec\n");
+    for (readers = 1;; readers *= 2) {
+        if (readers > maxReaders) readers = maxReaders;
+        runBenchmark(0, count, readers, writer, milliseconds, seed);
+        runBenchmark(1, count, readers, writer, milliseconds, seed);
+        if (readers == maxReaders) break;
+    }
+
+    return 0;
+}
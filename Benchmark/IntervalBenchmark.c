@@ -0,0 +1,94 @@
+/**
+ * @filename IntervalBenchmark.c
+ * @description Overlap query benchmark of the Red-Black interval tree
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 用法: IntervalBenchmark [-n maxCount] [-q queries] [-w width] [-s seed]
+ * 区间数从1000开始十倍递增到maxCount, 左端点在[0, 10n)中随机, 长度在[0, 100)中随机.
+ * 每个区间数分别测量点查询(stab)和宽度为width的窗口查询(window),
+ * method为tree的行使用overlapRBTree, 为scan的行按中序扫描全部区间逐个判断.
+ * 扫描的查询数受限于总共访问约1e7个结点, avg_results为每次查询的平均结果数.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "BenchmarkUtils.h"
+#include "../HeaderFiles/RBTreeInterval.h"
+#include "../HeaderFiles/BinarySearchTree.h"
+
+/* 扫描全部区间统计与[lo, hi]重叠的区间数 */
+static int scanOverlap(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi)
+{
+    Node *p;
+    int count = 0;
+
+    for (p = minBinarySearchTreeNode(root->node); p; p = BSTreeSuccessor(p)) {
+        if (p->data <= hi && p->hi >= lo) count++;
+    }
+
+    return count;
+}
+
+/* 运行一组查询并输出一行CSV */
+static void runQueries(RBRoot *root, int count, const char *query, int width, int scan, int queries,
+                       unsigned int seed)
+{
+    long long begin, elapsed, results = 0;
+    int i;
+
+    begin = benchNowNs();
+    for (i = 0; i < queries; i++) {
+        int lo = (int) (benchRandom(&seed) % (unsigned int) (count * 10));
+        if (scan) results += scanOverlap(root, lo, lo + width);
+        else results += overlapRBTree(root, lo, lo + width, NULL, NULL);
+    }
+    elapsed = benchNowNs() - begin;
+    if (elapsed <= 0) elapsed = 1;
+
+    printf("%d,%s,%s,%d,%.6f,%.0f,%.2f\n", count, query, scan ? "scan" : "tree", queries, elapsed / 1e9,
+           queries / (elapsed / 1e9), (double) results / queries);
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    int maxCount = 1000000, queries = 100000, width = 1000, count, i;
+    unsigned int seed = 20201218;
+
+    for (i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "-n")) maxCount = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-q")) queries = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-w")) width = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-s")) seed = (unsigned int) strtoul(argv[i + 1], NULL, 10);
+        else {
+            fprintf(stderr, "usage: %s [-n maxCount] [-q queries] [-w width] [-s seed]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (maxCount <= 0 || queries <= 0 || width < 0) return 1;
+
+    printf("intervals,query,method,queries,seconds,queries_per_sec,avg_results\n");
+    for (count = 1000;; count *= 10) {
+        RBRoot *root = createPooledRBTree(0);
+        int scanQueries;
+
+        if (count > maxCount) count = maxCount;
+        scanQueries = (int) (10000000LL / count < queries ? 10000000LL / count : queries);
+        if (scanQueries < 1) scanQueries = 1;
+        for (i = 0; i < count; i++) {
+            int lo = (int) (benchRandom(&seed) % (unsigned int) (count * 10));
+            insertIntervalRBTree(root, lo, lo + (int) (benchRandom(&seed) % 100));
+        }
+
+        runQueries(root, count, "stab", 0, 0, queries, seed);
+        runQueries(root, count, "stab", 0, 1, scanQueries, seed);
+        runQueries(root, count, "window", width, 0, queries, seed);
+        runQueries(root, count, "window", width, 1, scanQueries, seed);
+        destroyRBTree(root);
+        if (count == maxCount) break;
+    }
+
+    return 0;
+}
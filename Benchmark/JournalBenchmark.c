@@ -0,0 +1,77 @@
+/**
+ * @filename JournalBenchmark.c
+ * @description Write-ahead log group commit benchmark
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 用法: JournalBenchmark [-n count] [-d directory] [-s seed]
+ * 以不同的组大小插入count个随机键, group为1即每个操作落盘一次.
+ * 最后一列为重新打开日志(载入检查点并重放日志尾部)的耗时.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "BenchmarkUtils.h"
+#include "../HeaderFiles/RBTreeJournal.h"
+
+int main(int argc, char *argv[])
+{
+    static const int groups[] = {1, 8, 64, 512, 4096};
+    const char *directory = ".";
+    char logFile[1024], checkpointFile[1024];
+    int count = 20000, g, i;
+    unsigned int seed = 20201218;
+    int *keys;
+
+    for (i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "-n")) count = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-d")) directory = argv[i + 1];
+        else if (!strcmp(argv[i], "-s")) seed = (unsigned int) strtoul(argv[i + 1], NULL, 10);
+        else {
+            fprintf(stderr, "usage: %s [-n count] [-d directory] [-s seed]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (count <= 0) return 1;
+    snprintf(logFile, sizeof(logFile), "%s/JournalBenchmark.log", directory);
+    snprintf(checkpointFile, sizeof(checkpointFile), "%s/JournalBenchmark.rbt", directory);
+
+    keys = benchPermutation(count, &seed);
+    printf("group,ops,seconds,ops_per_sec,reopen_seconds\n");
+    for (g = 0; g < (int) (sizeof(groups) / sizeof(groups[0])); g++) {
+        RBRoot *root = createPooledRBTree(0);
+        RBTreeJournal *journal;
+        long long begin, elapsed, reopen;
+
+        remove(logFile);
+        remove(checkpointFile);
+        journal = openRBTreeJournal(root, logFile, checkpointFile, groups[g], 0);
+        if (!journal) {
+            fprintf(stderr, "cannot open %s\n", logFile);
+            return 1;
+        }
+
+        begin = benchNowNs();
+        for (i = 0; i < count; i++) insertRBTreeJournal(journal, keys[i]);
+        commitRBTreeJournal(journal);
+        elapsed = benchNowNs() - begin;
+        closeRBTreeJournal(journal);
+        destroyRBTree(root);
+
+        root = createPooledRBTree(0);
+        begin = benchNowNs();
+        journal = openRBTreeJournal(root, logFile, checkpointFile, groups[g], 0);
+        reopen = benchNowNs() - begin;
+        closeRBTreeJournal(journal);
+        destroyRBTree(root);
+
+        printf("%d,%d,%.6f,%.0f,%.6f\n", groups[g], count, elapsed / 1e9, count / (elapsed / 1e9), reopen / 1e9);
+        fflush(stdout);
+    }
+    remove(logFile);
+    remove(checkpointFile);
+    free(keys);
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/**
+ * @filename NodePoolBenchmark.c
+ * @description Node pool versus malloc benchmark
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../HeaderFiles/RedBlackTree.h"
+
+/* xorshift伪随机数, 保证两种分配方式使用相同的键序列 */
+static unsigned int nextRandom(unsigned int *state)
+{
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+
+    return x;
+}
+
+static double elapsedMs(clock_t begin)
+{
+    return (double) (clock() - begin) / CLOCKS_PER_SEC * 1000.0;
+}
+
+/**
+ * 在给定的红黑树上运行插入-删除-重新插入-销毁负载
+ *
+ * @param[in]  name : the name of the allocation strategy
+ * @param[in]  root : the root of the red-black tree
+ * @param[in]  count: the number of inserted keys
+ * @return  none
+ */
+static void runWorkload(const char *name, RBRoot *root, int count)
+{
+    unsigned int state = 2020;
+    clock_t begin;
+    double insertMs, deleteMs, reinsertMs, destroyMs;
+    int i;
+
+    begin = clock();
+    for (i = 0; i < count; i++) insertRBTree(root, (int) (nextRandom(&state) >> 1));
+    insertMs = elapsedMs(begin);
+
+    state = 2020;
+    begin = clock();
+    for (i = 0; i < count; i += 2) {
+        deleteRBTree(root, (int) (nextRandom(&state) >> 1));
+        nextRandom(&state);
+    }
+    deleteMs = elapsedMs(begin);
+
+    begin = clock();
+    for (i = 0; i < count / 2; i++) insertRBTree(root, (int) (nextRandom(&state) >> 1));
+    reinsertMs = elapsedMs(begin);
+
+    begin = clock();
+    destroyRBTree(root);
+    destroyMs = elapsedMs(begin);
+
+    printf("%-8s insert %10.2f ms  delete %10.2f ms  reinsert %10.2f ms  destroy %10.2f ms\n",
+           name, insertMs, deleteMs, reinsertMs, destroyMs);
+}
+
+int main(int argc, char *argv[])
+{
+    int count = argc > 1 ? atoi(argv[1]) : 1000000;
+    int chunkCapacity = argc > 2 ? atoi(argv[2]) : 0;
+
+    printf("nodes: %d\n", count);
+    runWorkload("malloc", createRBTree(), count);
+    runWorkload("pool", createPooledRBTree(chunkCapacity), count);
+
+    return 0;
+}
@@ -0,0 +1,631 @@
+/**
+ * @filename RBTreeBenchmark.c
+ * @description Red-Black tree workload benchmark suite
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 用法: RBTreeBenchmark [-n count] [-s seed] [-w workload] [-a malloc|pool] [-t threads]
+ * allocator列为index32的行是下标链接的紧凑红黑树, 为frozen的行是冻结为Eytzinger布局的只读红黑树,
+ * 为topdown的行是没有父结点指针, 自顶向下单趟插入和删除的红黑树,
+ * 为typed_u64的行是RBTREE_DEFINE生成的64位无符号整数键, double值的特化红黑树.
+ * 成组计时的负载(merge_union, batch_apply, batch_lookup, file_dump, file_load)的延迟分位数是每组的延迟, ops和吞吐量按键数计算;
+ * -t为集合运算的线程数.
+ * 每个负载输出一行CSV: 吞吐量以及单次操作延迟的p50/p99/p999(纳秒).
+ * 耗时为被测操作的延迟之和, 不包含预先建树和销毁.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "BenchmarkUtils.h"
+#include "../HeaderFiles/RedBlackTree.h"
+#include "../HeaderFiles/IndexedRBTree.h"
+#include "../HeaderFiles/RBTreeSetOperations.h"
+#include "../HeaderFiles/RBTreeFile.h"
+#include "../HeaderFiles/FrozenRBTree.h"
+#include "../HeaderFiles/TopDownRBTree.h"
+#include "../HeaderFiles/RedBlackTreeTemplate.h"
+
+/* 64位键的特化红黑树, 键的高32位为原键, 低32位打乱, 比较不能截断为int */
+#define U64Compare(a, b) RBTreeCompareScalar(a, b)
+RBTREE_DEFINE(U64Tree, uint64_t, double, U64Compare)
+#define U64Key(x) (((uint64_t) (unsigned int) (x) << 32) | ((unsigned int) (x) * 2654435761u))
+
+/* 一次负载运行的上下文 */
+typedef struct BenchContext {
+    int count;             /* 负载规模 */
+    unsigned int seed;     /* 随机数种子 */
+    int pooled;            /* 是否使用结点池 */
+    int threads;           /* 集合运算的线程数 */
+    long long *latency;    /* 单次操作延迟样本 */
+    long ops;              /* 已记录的延迟样本数 */
+    long items;            /* 成组计时时的逻辑操作数, 为0表示与样本数相同 */
+} BenchContext;
+
+/* 计时执行一次操作并记录延迟 */
+#define BENCH_OP(ctx, stmt) do {                          \
+    long long begin_ = benchNowNs();                      \
+    stmt;                                                 \
+    (ctx)->latency[(ctx)->ops++] = benchNowNs() - begin_; \
+} while (0)
+
+static RBRoot *newTree(BenchContext *ctx)
+{
+    return ctx->pooled ? createPooledRBTree(0) : createRBTree();
+}
+
+/* 预先构建包含0, step, 2 * step, ...共count个键的红黑树, 不计入测量 */
+static RBRoot *prebuiltTree(BenchContext *ctx, int step)
+{
+    RBRoot *root = newTree(ctx);
+    int *keys = (int *) malloc(sizeof(int) * ctx->count);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) keys[i] = i * step;
+    buildRBTreeFromSorted(root, keys, ctx->count);
+    free(keys);
+
+    return root;
+}
+
+/* 按随机顺序插入0到count - 1预先构建红黑树, 与prebuiltTopDownTree插入相同的键序列, 不计入测量 */
+static RBRoot *prebuiltRandomTree(BenchContext *ctx)
+{
+    RBRoot *root = newTree(ctx);
+    int *keys = benchPermutation(ctx->count, &ctx->seed);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) insertRBTree(root, keys[i]);
+    free(keys);
+
+    return root;
+}
+
+/* 顺序插入 */
+static void sequentialInsert(BenchContext *ctx)
+{
+    RBRoot *root = newTree(ctx);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) BENCH_OP(ctx, insertRBTree(root, i));
+    destroyRBTree(root);
+}
+
+/* 近似递增的键: 第i个键在i * 4附近抖动, 模拟乱序到达的时间戳 */
+static int *nearSequentialKeys(BenchContext *ctx)
+{
+    int *keys = (int *) malloc(sizeof(int) * ctx->count);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) keys[i] = i * 4 + (int) (benchRandom(&ctx->seed) % 64) - 32;
+
+    return keys;
+}
+
+/* 近似顺序插入, 每次从根结点下降 */
+static void nearSequentialInsert(BenchContext *ctx)
+{
+    RBRoot *root = newTree(ctx);
+    int *keys = nearSequentialKeys(ctx);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) BENCH_OP(ctx, insertRBTree(root, keys[i]));
+    free(keys);
+    destroyRBTree(root);
+}
+
+/* 近似顺序插入, 以上一次插入的结点为提示 */
+static void nearSequentialHint(BenchContext *ctx)
+{
+    RBRoot *root = newTree(ctx);
+    int *keys = nearSequentialKeys(ctx);
+    Node *hint = NULL;
+    int i;
+
+    for (i = 0; i < ctx->count; i++) BENCH_OP(ctx, hint = insertHintRBTree(root, hint, keys[i], NULL));
+    free(keys);
+    destroyRBTree(root);
+}
+
+/* 随机插入 */
+static void randomInsert(BenchContext *ctx)
+{
+    RBRoot *root = newTree(ctx);
+    int *keys = benchPermutation(ctx->count, &ctx->seed);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) BENCH_OP(ctx, insertRBTree(root, keys[i]));
+    free(keys);
+    destroyRBTree(root);
+}
+
+/* 命中查找, 键均匀分布, 树按随机顺序插入构建, 与topdown的行形状可比 */
+static void lookupHit(BenchContext *ctx)
+{
+    RBRoot *root = prebuiltRandomTree(ctx);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) {
+        int x = (int) (benchRandom(&ctx->seed) % (unsigned int) ctx->count);
+        BENCH_OP(ctx, searchRBTreeNode(root, x));
+    }
+    destroyRBTree(root);
+}
+
+/* 未命中查找, 树中只有偶数键 */
+static void lookupMiss(BenchContext *ctx)
+{
+    RBRoot *root = prebuiltTree(ctx, 2);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) {
+        int x = (int) (benchRandom(&ctx->seed) % (unsigned int) ctx->count) * 2 + 1;
+        BENCH_OP(ctx, searchRBTreeNode(root, x));
+    }
+    destroyRBTree(root);
+}
+
+/* Zipf倾斜查找, 热点键分散在整棵树中 */
+static void zipfLookup(BenchContext *ctx)
+{
+    RBRoot *root = prebuiltTree(ctx, 1);
+    BenchZipf zipf;
+    int i;
+
+    benchZipfInit(&zipf, ctx->count, 0.99);
+    for (i = 0; i < ctx->count; i++) {
+        unsigned int rank = (unsigned int) benchZipfNext(&zipf, &ctx->seed);
+        int x = (int) ((rank * 2654435761u) % (unsigned int) ctx->count);
+        BENCH_OP(ctx, searchRBTreeNode(root, x));
+    }
+    destroyRBTree(root);
+}
+
+/* 以随机顺序删除全部结点, 树按随机顺序插入构建, 与topdown的行形状可比 */
+static void deleteHeavy(BenchContext *ctx)
+{
+    RBRoot *root = prebuiltRandomTree(ctx);
+    int *keys = benchPermutation(ctx->count, &ctx->seed);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) BENCH_OP(ctx, deleteRBTree(root, keys[i]));
+    free(keys);
+    destroyRBTree(root);
+}
+
+/* 读写混合: 80%查找, 10%插入, 10%删除, 键位于[0, 2 * count) */
+static void mixedReadWrite(BenchContext *ctx)
+{
+    RBRoot *root = prebuiltTree(ctx, 2);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) {
+        unsigned int r = benchRandom(&ctx->seed);
+        int x = (int) (benchRandom(&ctx->seed) % (2u * (unsigned int) ctx->count));
+        if (r % 10 < 8) BENCH_OP(ctx, searchRBTreeNode(root, x));
+        else if (r % 10 == 8) BENCH_OP(ctx, insertRBTree(root, x));
+        else BENCH_OP(ctx, deleteRBTree(root, x));
+    }
+    destroyRBTree(root);
+}
+
+/* 合并的第二个集合: 0, 3, 6, ..., 与偶数键的树有三分之一重叠 */
+static int *mergeKeys(BenchContext *ctx)
+{
+    int *keys = (int *) malloc(sizeof(int) * ctx->count);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) keys[i] = i * 3;
+
+    return keys;
+}
+
+/* 逐个插入合并两个集合 */
+static void mergeInsert(BenchContext *ctx)
+{
+    RBRoot *root = prebuiltTree(ctx, 2);
+    int *keys = mergeKeys(ctx);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) BENCH_OP(ctx, insertRBTree(root, keys[i]));
+    free(keys);
+    destroyRBTree(root);
+}
+
+/* 以并集合并两个集合 */
+static void mergeUnion(BenchContext *ctx)
+{
+    RBRoot *root = prebuiltTree(ctx, 2), *other = createRBTree();
+    int *keys = mergeKeys(ctx);
+
+    setRBTreeAllocator(other, root->allocator);
+    buildRBTreeFromSorted(other, keys, ctx->count);
+    BENCH_OP(ctx, unionRBTree(root, other, ctx->threads));
+    ctx->items = ctx->count;
+    other->allocator = NULL;
+    destroyRBTree(other);
+    free(keys);
+    destroyRBTree(root);
+}
+
+#define BENCH_BATCH 1024 /* batch_apply和batch_lookup每组的操作数 */
+
+static int compareBatchOp(const void *a, const void *b)
+{
+    RBTreeElemType x = ((const RBTreeBatchOp *) a)->key, y = ((const RBTreeBatchOp *) b)->key;
+
+    return (x > y) - (x < y);
+}
+
+/* 按键排序的批量操作: 键位于[0, 2 * count), 插入和删除各占一半 */
+static RBTreeBatchOp *batchOps(BenchContext *ctx)
+{
+    RBTreeBatchOp *ops = (RBTreeBatchOp *) malloc(sizeof(RBTreeBatchOp) * ctx->count);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) {
+        ops[i].key = (int) (benchRandom(&ctx->seed) % (2u * (unsigned int) ctx->count));
+        ops[i].type = benchRandom(&ctx->seed) & 1 ? RBTREE_BATCH_DELETE : RBTREE_BATCH_INSERT;
+    }
+    qsort(ops, (size_t) ctx->count, sizeof(RBTreeBatchOp), compareBatchOp);
+
+    return ops;
+}
+
+/* 有序操作逐个调用insertRBTree/deleteRBTree */
+static void batchLoop(BenchContext *ctx)
+{
+    RBRoot *root = prebuiltTree(ctx, 2);
+    RBTreeBatchOp *ops = batchOps(ctx);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) {
+        if (ops[i].type == RBTREE_BATCH_INSERT) BENCH_OP(ctx, insertRBTree(root, ops[i].key));
+        else BENCH_OP(ctx, deleteRBTree(root, ops[i].key));
+    }
+    free(ops);
+    destroyRBTree(root);
+}
+
+/* 同样的有序操作每BENCH_BATCH个一组调用applyBatchRBTree */
+static void batchApply(BenchContext *ctx)
+{
+    RBRoot *root = prebuiltTree(ctx, 2);
+    RBTreeBatchOp *ops = batchOps(ctx);
+    int i;
+
+    for (i = 0; i < ctx->count; i += BENCH_BATCH) {
+        int n = ctx->count - i < BENCH_BATCH ? ctx->count - i : BENCH_BATCH;
+        BENCH_OP(ctx, applyBatchRBTree(root, ops + i, n, NULL));
+    }
+    ctx->items = ctx->count;
+    free(ops);
+    destroyRBTree(root);
+}
+
+/* 与lookup_hit同样的键每BENCH_BATCH个一组调用searchBatchRBTree */
+static void batchLookup(BenchContext *ctx)
+{
+    RBRoot *root = prebuiltTree(ctx, 1);
+    int *keys = (int *) malloc(sizeof(int) * ctx->count);
+    Node **results = (Node **) malloc(sizeof(Node *) * BENCH_BATCH);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) keys[i] = (int) (benchRandom(&ctx->seed) % (unsigned int) ctx->count);
+    for (i = 0; i < ctx->count; i += BENCH_BATCH) {
+        int n = ctx->count - i < BENCH_BATCH ? ctx->count - i : BENCH_BATCH;
+        BENCH_OP(ctx, searchBatchRBTree(root, keys + i, n, results));
+    }
+    ctx->items = ctx->count;
+    free(results);
+    free(keys);
+    destroyRBTree(root);
+}
+
+#define BENCH_FILE "RBTreeBenchmark.rbt" /* file_dump和file_load使用的临时文件 */
+
+/* 导出到文件, 键间隔为2 */
+static void fileDump(BenchContext *ctx)
+{
+    RBRoot *root = prebuiltTree(ctx, 2);
+
+    BENCH_OP(ctx, dumpRBTree(root, BENCH_FILE));
+    ctx->items = ctx->count;
+    remove(BENCH_FILE);
+    destroyRBTree(root);
+}
+
+/* 由文件载入, 与random_insert对比重建索引的代价 */
+static void fileLoad(BenchContext *ctx)
+{
+    RBRoot *root = prebuiltTree(ctx, 2);
+
+    dumpRBTree(root, BENCH_FILE);
+    destroyRBTree(root);
+    root = newTree(ctx);
+    BENCH_OP(ctx, loadRBTree(root, BENCH_FILE));
+    ctx->items = ctx->count;
+    remove(BENCH_FILE);
+    destroyRBTree(root);
+}
+
+/* 下标链接的紧凑红黑树随机插入 */
+static void indexedRandomInsert(BenchContext *ctx)
+{
+    IndexedRBTree *tree = createIndexedRBTree(0);
+    int *keys = benchPermutation(ctx->count, &ctx->seed);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) BENCH_OP(ctx, insertIndexedRBTree(tree, keys[i]));
+    free(keys);
+    destroyIndexedRBTree(tree);
+}
+
+/* 下标链接的紧凑红黑树命中查找 */
+static void indexedLookupHit(BenchContext *ctx)
+{
+    IndexedRBTree *tree = createIndexedRBTree(ctx->count);
+    int *keys = benchPermutation(ctx->count, &ctx->seed);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) insertIndexedRBTree(tree, keys[i]);
+    for (i = 0; i < ctx->count; i++) {
+        int x = (int) (benchRandom(&ctx->seed) % (unsigned int) ctx->count);
+        BENCH_OP(ctx, searchIndexedRBTree(tree, x));
+    }
+    free(keys);
+    destroyIndexedRBTree(tree);
+}
+
+/* 冻结的只读红黑树查找, 键间隔为step, 与lookup_hit和lookup_miss使用同样的键 */
+static void frozenLookup(BenchContext *ctx, int step, int offset)
+{
+    RBRoot *root = prebuiltTree(ctx, step);
+    FrozenRBTree *frozen = freezeRBTree(root);
+    int i;
+
+    destroyRBTree(root);
+    for (i = 0; i < ctx->count; i++) {
+        int x = (int) (benchRandom(&ctx->seed) % (unsigned int) ctx->count) * step + offset;
+        BENCH_OP(ctx, searchFrozenRBTree(frozen, x));
+    }
+    destroyFrozenRBTree(frozen);
+}
+
+/* 冻结的只读红黑树命中查找 */
+static void frozenLookupHit(BenchContext *ctx)
+{
+    frozenLookup(ctx, 1, 0);
+}
+
+/* 冻结的只读红黑树未命中查找 */
+static void frozenLookupMiss(BenchContext *ctx)
+{
+    frozenLookup(ctx, 2, 1);
+}
+
+/* 按随机顺序插入0到count - 1预先构建自顶向下红黑树, 与prebuiltRandomTree插入相同的键序列, 不计入测量 */
+static TopDownRBTree *prebuiltTopDownTree(BenchContext *ctx)
+{
+    TopDownRBTree *tree = createTopDownRBTree();
+    int *keys = benchPermutation(ctx->count, &ctx->seed);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) insertTopDownRBTree(tree, keys[i]);
+    free(keys);
+
+    return tree;
+}
+
+/* 自顶向下红黑树顺序插入 */
+static void topDownSequentialInsert(BenchContext *ctx)
+{
+    TopDownRBTree *tree = createTopDownRBTree();
+    int i;
+
+    for (i = 0; i < ctx->count; i++) BENCH_OP(ctx, insertTopDownRBTree(tree, i));
+    destroyTopDownRBTree(tree);
+}
+
+/* 自顶向下红黑树随机插入 */
+static void topDownRandomInsert(BenchContext *ctx)
+{
+    TopDownRBTree *tree = createTopDownRBTree();
+    int *keys = benchPermutation(ctx->count, &ctx->seed);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) BENCH_OP(ctx, insertTopDownRBTree(tree, keys[i]));
+    free(keys);
+    destroyTopDownRBTree(tree);
+}
+
+/* 自顶向下红黑树命中查找 */
+static void topDownLookupHit(BenchContext *ctx)
+{
+    TopDownRBTree *tree = prebuiltTopDownTree(ctx);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) {
+        int x = (int) (benchRandom(&ctx->seed) % (unsigned int) ctx->count);
+        BENCH_OP(ctx, searchTopDownRBTree(tree, x));
+    }
+    destroyTopDownRBTree(tree);
+}
+
+/* 自顶向下红黑树按随机顺序删除全部结点 */
+static void topDownDeleteHeavy(BenchContext *ctx)
+{
+    TopDownRBTree *tree = prebuiltTopDownTree(ctx);
+    int *keys = benchPermutation(ctx->count, &ctx->seed);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) BENCH_OP(ctx, deleteTopDownRBTree(tree, keys[i]));
+    free(keys);
+    destroyTopDownRBTree(tree);
+}
+
+/* 预先按随机顺序插入count个键构建特化红黑树, 不计入测量 */
+static U64TreeRoot *prebuiltTypedTree(BenchContext *ctx)
+{
+    U64TreeRoot *root = U64TreeCreate();
+    int *keys = benchPermutation(ctx->count, &ctx->seed);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) U64TreeInsert(root, U64Key(keys[i]), keys[i] * 0.5);
+    free(keys);
+
+    return root;
+}
+
+/* 特化红黑树随机插入 */
+static void typedRandomInsert(BenchContext *ctx)
+{
+    U64TreeRoot *root = U64TreeCreate();
+    int *keys = benchPermutation(ctx->count, &ctx->seed);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) BENCH_OP(ctx, U64TreeInsert(root, U64Key(keys[i]), keys[i] * 0.5));
+    free(keys);
+    U64TreeDestroy(root);
+}
+
+/* 特化红黑树命中查找 */
+static void typedLookupHit(BenchContext *ctx)
+{
+    U64TreeRoot *root = prebuiltTypedTree(ctx);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) {
+        int x = (int) (benchRandom(&ctx->seed) % (unsigned int) ctx->count);
+        BENCH_OP(ctx, U64TreeSearch(root, U64Key(x)));
+    }
+    U64TreeDestroy(root);
+}
+
+/* 特化红黑树按随机顺序删除全部结点 */
+static void typedDeleteHeavy(BenchContext *ctx)
+{
+    U64TreeRoot *root = prebuiltTypedTree(ctx);
+    int *keys = benchPermutation(ctx->count, &ctx->seed);
+    int i;
+
+    for (i = 0; i < ctx->count; i++) BENCH_OP(ctx, U64TreeDelete(root, U64Key(keys[i])));
+    free(keys);
+    U64TreeDestroy(root);
+}
+
+/* 负载表, allocator不为NULL时负载自带存储方式, 只运行一次 */
+typedef struct BenchWorkload {
+    const char *name;
+    void (*run)(BenchContext *ctx);
+    const char *allocator;
+} BenchWorkload;
+
+static const BenchWorkload workloads[] = {
+        {"sequential_insert", sequentialInsert,      NULL},
+        {"near_seq_insert",   nearSequentialInsert,  NULL},
+        {"near_seq_hint",     nearSequentialHint,    NULL},
+        {"random_insert",     randomInsert,          NULL},
+        {"lookup_hit",        lookupHit,             NULL},
+        {"lookup_miss",       lookupMiss,            NULL},
+        {"zipf_lookup",       zipfLookup,            NULL},
+        {"delete_heavy",      deleteHeavy,           NULL},
+        {"mixed_read_write",  mixedReadWrite,        NULL},
+        {"merge_insert",      mergeInsert,           NULL},
+        {"merge_union",       mergeUnion,            NULL},
+        {"batch_loop",        batchLoop,             NULL},
+        {"batch_apply",       batchApply,            NULL},
+        {"batch_lookup",      batchLookup,           NULL},
+        {"file_dump",         fileDump,              NULL},
+        {"file_load",         fileLoad,              NULL},
+        {"random_insert",     indexedRandomInsert,   "index32"},
+        {"lookup_hit",        indexedLookupHit,      "index32"},
+        {"lookup_hit",        frozenLookupHit,       "frozen"},
+        {"lookup_miss",       frozenLookupMiss,      "frozen"},
+        {"sequential_insert", topDownSequentialInsert, "topdown"},
+        {"random_insert",     topDownRandomInsert,   "topdown"},
+        {"lookup_hit",        topDownLookupHit,      "topdown"},
+        {"delete_heavy",      topDownDeleteHeavy,    "topdown"},
+        {"random_insert",     typedRandomInsert,     "typed_u64"},
+        {"lookup_hit",        typedLookupHit,        "typed_u64"},
+        {"delete_heavy",      typedDeleteHeavy,      "typed_u64"},
+};
+
+/**
+ * 运行一个负载并输出一行CSV结果
+ *
+ * @param[in]  workload: the workload to run
+ * @param[in]  count   : the size of the workload
+ * @param[in]  seed    : the random seed
+ * @param[in]  pooled  : 1 to use the node pool, 0 to use malloc
+ * @param[in]  threads : the number of threads for set operations
+ * @return  none
+ */
+static void runWorkload(const BenchWorkload *workload, int count, unsigned int seed, int pooled, int threads)
+{
+    BenchContext ctx;
+    long long elapsed = 0;
+    long i;
+
+    ctx.count = count;
+    ctx.seed = seed;
+    ctx.pooled = pooled;
+    ctx.threads = threads;
+    ctx.ops = 0;
+    ctx.items = 0;
+    ctx.latency = (long long *) malloc(sizeof(long long) * count);
+    if (!ctx.latency) return;
+
+    workload->run(&ctx);
+    for (i = 0; i < ctx.ops; i++) elapsed += ctx.latency[i];
+    if (elapsed <= 0) elapsed = 1;
+
+    if (!ctx.items) ctx.items = ctx.ops;
+
+    benchSortSamples(ctx.latency, ctx.ops);
+    printf("%s,%s,%d,%ld,%.6f,%.0f,%lld,%lld,%lld\n", workload->name,
+           workload->allocator ? workload->allocator : pooled ? "pool" : "malloc", count, ctx.items,
+           elapsed / 1e9, ctx.items / (elapsed / 1e9),
+           benchPercentile(ctx.latency, ctx.ops, 50), benchPercentile(ctx.latency, ctx.ops, 99),
+           benchPercentile(ctx.latency, ctx.ops, 99.9));
+    fflush(stdout);
+    free(ctx.latency);
+}
+
+int main(int argc, char *argv[])
+{
+    int count = 1000000, allocators = 3, threads = 1, i, j;
+    unsigned int seed = 2020;
+    const char *only = NULL;
+
+    for (i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "-n")) count = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-s")) seed = (unsigned int) strtoul(argv[i + 1], NULL, 10);
+        else if (!strcmp(argv[i], "-w")) only = argv[i + 1];
+        else if (!strcmp(argv[i], "-a")) allocators = !strcmp(argv[i + 1], "pool") ? 2 : 1;
+        else if (!strcmp(argv[i], "-t")) threads = atoi(argv[i + 1]);
+        else {
+            fprintf(stderr, "usage: %s [-n count] [-s seed] [-w workload] [-a malloc|pool] [-t threads]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (count <= 0 || seed == 0) {
+        fprintf(stderr, "count and seed must be positive\n");
+        return 1;
+    }
+
+    printf("workload,allocator,nodes,ops,seconds,ops_per_sec,p50_ns,p99_ns,p999_ns\n");
+    for (i = 0; i < (int) (sizeof(workloads) / sizeof(workloads[0])); i++) {
+        if (only && strcmp(only, workloads[i].name)) continue;
+        if (workloads[i].allocator) {
+            runWorkload(&workloads[i], count, seed, 0, threads);
+            continue;
+        }
+        for (j = 0; j < 2; j++) {
+            if (allocators & (1 << j)) runWorkload(&workloads[i], count, seed, j, threads);
+        }
+    }
+
+    return 0;
+}
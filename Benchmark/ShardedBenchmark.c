@@ -0,0 +1,152 @@
+/**
+ * @filename ShardedBenchmark.c
+ * @description Write throughput scaling benchmark of the sharded Red-Black tree
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 用法: ShardedBenchmark [-n count] [-t maxThreads] [-S shards] [-s seed]
+ * 写者线程数从1开始倍增到maxThreads, 所有线程共插入count个不同的随机键.
+ * mutex为以全局互斥锁包装一棵红黑树, sharded为按键范围分片.
+ * dist为uniform时键均匀落在建树时预期的范围内; 为shifted时键全部超出预期范围,
+ * 起初都落到最后一个分片, 用来衡量边界自动调整的效果.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "BenchmarkUtils.h"
+#include "../HeaderFiles/ShardedRBTree.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+/* 一次测量中所有线程共享的状态 */
+typedef struct BenchShared {
+    int sharded;               /* 1为分片红黑树, 0为全局互斥锁 */
+    int start;                 /* 线程同时开始的信号 */
+    RBRoot *root;              /* mutex模式的红黑树 */
+    pthread_mutex_t lock;      /* mutex模式的全局锁 */
+    ShardedRBTree *tree;       /* sharded模式的红黑树 */
+} BenchShared;
+
+/* 单个写者线程负责的键 */
+typedef struct BenchThread {
+    BenchShared *shared;
+    pthread_t thread;
+    const int *keys;
+    int count;
+} BenchThread;
+
+static void *writerMain(void *arg)
+{
+    BenchThread *self = (BenchThread *) arg;
+    BenchShared *shared = self->shared;
+    int i;
+
+    while (!__atomic_load_n(&shared->start, __ATOMIC_ACQUIRE));
+    for (i = 0; i < self->count; i++) {
+        if (shared->sharded) insertShardedRBTree(shared->tree, self->keys[i]);
+        else {
+            pthread_mutex_lock(&shared->lock);
+            insertRBTree(shared->root, self->keys[i]);
+            pthread_mutex_unlock(&shared->lock);
+        }
+    }
+
+    return NULL;
+}
+
+static int countVisit(Node *node, void *arg)
+{
+    (void) node;
+    (*(int *) arg)++;
+
+    return 0;
+}
+
+/* 运行一次测量并输出一行CSV */
+static void runBenchmark(int sharded, int shifted, const int *keys, int count, int threadCount, int shardCount)
+{
+    BenchShared shared;
+    BenchThread *threads = (BenchThread *) calloc((size_t) threadCount, sizeof(BenchThread));
+    long long begin, elapsed;
+    int size = 0, i;
+
+    memset(&shared, 0, sizeof(shared));
+    shared.sharded = sharded;
+    if (sharded) shared.tree = createShardedRBTree(shardCount, 0, count);
+    else {
+        shared.root = createPooledRBTree(0);
+        pthread_mutex_init(&shared.lock, NULL);
+    }
+
+    for (i = 0; i < threadCount; i++) {
+        int begin = (int) ((long long) i * count / threadCount);
+        threads[i].shared = &shared;
+        threads[i].keys = keys + begin;
+        threads[i].count = (int) ((long long) (i + 1) * count / threadCount) - begin;
+        pthread_create(&threads[i].thread, NULL, writerMain, &threads[i]);
+    }
+
+    begin = benchNowNs();
+    __atomic_store_n(&shared.start, 1, __ATOMIC_RELEASE);
+    for (i = 0; i < threadCount; i++) pthread_join(threads[i].thread, NULL);
+    elapsed = benchNowNs() - begin;
+
+    if (sharded) visitShardedRBTree(shared.tree, countVisit, &size);
+    else visitRBTree(shared.root, RBTREE_INORDER, countVisit, &size);
+    if (size != count) fprintf(stderr, "size mismatch: %d != %d\n", size, count);
+
+    printf("%s,%s,%d,%d,%d,%.6f,%.0f\n", sharded ? "sharded" : "mutex", shifted ? "shifted" : "uniform",
+           threadCount, sharded ? shardCount : 1, count, elapsed / 1e9, count / (elapsed / 1e9));
+    fflush(stdout);
+
+    if (sharded) destroyShardedRBTree(shared.tree);
+    else {
+        destroyRBTree(shared.root);
+        pthread_mutex_destroy(&shared.lock);
+    }
+    free(threads);
+}
+
+int main(int argc, char *argv[])
+{
+    int count = 1000000, maxThreads = 8, shardCount = 0, shifted, threads, i;
+    unsigned int seed = 20201218;
+    int *keys;
+
+#ifndef _WIN32
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus > 0) maxThreads = (int) cpus;
+#endif
+
+    for (i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "-n")) count = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-t")) maxThreads = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-S")) shardCount = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-s")) seed = (unsigned int) strtoul(argv[i + 1], NULL, 10);
+        else {
+            fprintf(stderr, "usage: %s [-n count] [-t maxThreads] [-S shards] [-s seed]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (count <= 0 || maxThreads <= 0) return 1;
+    if (shardCount <= 0) shardCount = maxThreads * 4;
+
+    keys = benchPermutation(count, &seed);
+    printf("mode,dist,threads,shards,inserts,seconds,inserts_per_sec\n");
+    for (shifted = 0; shifted <= 1; shifted++) {
+        if (shifted) for (i = 0; i < count; i++) keys[i] += count;
+        for (threads = 1;; threads *= 2) {
+            if (threads > maxThreads) threads = maxThreads;
+            runBenchmark(0, shifted, keys, count, threads, shardCount);
+            runBenchmark(1, shifted, keys, count, threads, shardCount);
+            if (threads == maxThreads) break;
+        }
+    }
+    free(keys);
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * @filename TraversalBenchmark.c
+ * @description Recursive versus iterative search, traversal and teardown benchmark
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../HeaderFiles/RedBlackTree.h"
+#include "../HeaderFiles/BinaryTree.h"
+#include "../HeaderFiles/BinarySearchTree.h"
+
+static double elapsedMs(clock_t begin)
+{
+    return (double) (clock() - begin) / CLOCKS_PER_SEC * 1000.0;
+}
+
+/* 递归实现的查找, 作为对照 */
+static RBTree recursiveSearchReference(RBTree tree, RBTreeElemType x)
+{
+    if (!tree || tree->data == x) return tree;
+    else if (tree->data > x) return recursiveSearchReference(tree->left, x);
+    else return recursiveSearchReference(tree->right, x);
+}
+
+/* 递归实现的中序遍历求和, 作为对照 */
+static long long recursiveInorderReference(RBTree tree)
+{
+    if (!tree) return 0;
+
+    return recursiveInorderReference(tree->left) + tree->data + recursiveInorderReference(tree->right);
+}
+
+/* 递归实现的销毁, 作为对照 */
+static void recursiveDestroyReference(RBTree tree)
+{
+    if (!tree) return;
+
+    recursiveDestroyReference(tree->left);
+    recursiveDestroyReference(tree->right);
+    free(tree);
+}
+
+/* 中序遍历求和的回调 */
+static int sumVisit(Node *node, void *arg)
+{
+    *(long long *) arg += node->data;
+
+    return 0;
+}
+
+/* 以随机顺序插入0到count-1 */
+static RBRoot *buildTree(int count)
+{
+    RBRoot *root = createRBTree();
+    int *keys = (int *) malloc(sizeof(int) * count);
+    unsigned int state = 2020;
+    int i;
+
+    for (i = 0; i < count; i++) keys[i] = i;
+    for (i = count - 1; i > 0; i--) {
+        int j, temp;
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        j = (int) (state % (unsigned int) (i + 1));
+        temp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = temp;
+    }
+    for (i = 0; i < count; i++) insertRBTree(root, keys[i]);
+    free(keys);
+
+    return root;
+}
+
+int main(int argc, char *argv[])
+{
+    int count = argc > 1 ? atoi(argv[1]) : 10000000;
+    RBRoot *root = buildTree(count);
+    clock_t begin;
+    long long found = 0, sum = 0;
+    Node *p;
+    int i;
+
+    printf("nodes: %d\n", count);
+
+    begin = clock();
+    for (i = 0; i < count; i++) found += recursiveSearchReference(root->node, i) != NULL;
+    printf("search    recursive %10.2f ms (%lld found)\n", elapsedMs(begin), found);
+
+    found = 0;
+    begin = clock();
+    for (i = 0; i < count; i++) found += searchBiTreeNode(root->node, i) != NULL;
+    printf("search    iterative %10.2f ms (%lld found)\n", elapsedMs(begin), found);
+
+    begin = clock();
+    sum = recursiveInorderReference(root->node);
+    printf("inorder   recursive %10.2f ms (sum %lld)\n", elapsedMs(begin), sum);
+
+    sum = 0;
+    begin = clock();
+    visitRBTree(root, RBTREE_INORDER, sumVisit, &sum);
+    printf("inorder   visitor   %10.2f ms (sum %lld)\n", elapsedMs(begin), sum);
+
+    sum = 0;
+    begin = clock();
+    for (p = minBinarySearchTreeNode(root->node); p; p = BSTreeSuccessor(p)) sum += p->data;
+    printf("inorder   successor %10.2f ms (sum %lld)\n", elapsedMs(begin), sum);
+
+    begin = clock();
+    recursiveDestroyReference(root->node);
+    printf("destroy   recursive %10.2f ms\n", elapsedMs(begin));
+    root->node = NULL;
+    destroyRBTree(root);
+
+    root = buildTree(count);
+    begin = clock();
+    destroyBinaryTree(root->node);
+    printf("destroy   iterative %10.2f ms\n", elapsedMs(begin));
+    root->node = NULL;
+    destroyRBTree(root);
+
+    return 0;
+}
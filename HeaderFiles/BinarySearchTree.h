@@ -13,12 +13,27 @@
 /* 二叉查找树插入结点 */
 Status insertBinarySearchTree(RBRoot *root, Node *node);
 
+/* 二叉查找树单次下降查找结点或其插入位置 */
+RBTree searchInsertPosition(RBRoot *root, RBTree tree, RBTreeElemType x, Node **parent);
+
+/* 二叉查找树将结点链接到插入位置 */
+Status linkBinarySearchTree(RBRoot *root, Node *node, Node *parent);
+
+/* 二叉查找树从指针结点回溯到可能包含x的子树 */
+RBTree BSTreeFingerAncestor(RBTree finger, RBTreeElemType x);
+
 /* 二叉查找树查找最小结点 */
 RBTree minBinarySearchTreeNode(RBTree tree);
 
 /* 二叉查找树查找最大结点 */
 RBTree maxBinarySearchTreeNode(RBTree tree);
 
+/* 二叉查找树查找第一个不小于x的结点 */
+RBTree BSTreeLowerBound(RBTree tree, RBTreeElemType x);
+
+/* 二叉查找树查找第一个大于x的结点 */
+RBTree BSTreeUpperBound(RBTree tree, RBTreeElemType x);
+
 /* 二叉查找树查找前驱结点 */
 RBTree BSTreePrecursor(RBTree node);
 
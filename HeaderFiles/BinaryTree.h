@@ -13,6 +13,9 @@
 /* 销毁二叉树 */
 Status destroyBinaryTree(RBTree tree);
 
+/* 以回调方式遍历二叉树 */
+Status visitBiTree(RBTree tree, RBTreeOrder order, RBTreeVisitFunc visit, void *arg);
+
 /* 前序遍历二叉树 */
 Status preorderBiTree(RBTree tree);
 
@@ -23,6 +26,9 @@ Status inorderBiTree(RBTree tree);
 Status postorderBiTree(RBTree tree);
 
 /* 查找结点 */
-RBTree recursiveSearchNode(RBTree tree, RBTreeElemType x);
+RBTree searchBiTreeNode(RBTree tree, RBTreeElemType x);
+
+/* 已弃用: 查找已改为循环实现, 请使用searchBiTreeNode */
+#define recursiveSearchNode(tree, x) searchBiTreeNode(tree, x)
 
 #endif /* BINARYTREE_H */
@@ -0,0 +1,67 @@
+/**
+ * @filename CombiningRBTree.h
+ * @description Flat-combining concurrent Red-Black tree interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef COMBININGRBTREE_H
+#define COMBININGRBTREE_H
+
+#if RBTREE_COMBINING
+
+#include <pthread.h>
+
+#define RBTREE_COMBINING_MAX_THREADS 128 /* 可注册的线程数上限 */
+
+/* 发布到槽位中的操作 */
+typedef enum {
+    RBTREE_COMBINING_IDLE = 0,   /* 没有待执行的操作 */
+    RBTREE_COMBINING_INSERT = 1,
+    RBTREE_COMBINING_DELETE = 2,
+    RBTREE_COMBINING_SEARCH = 3
+} RBTreeCombiningOp;
+
+/* 线程的发布槽位, 独占一个缓存行避免伪共享 */
+typedef struct RBTreeCombiningSlot {
+    int op;                    /* 发布的操作, 合并者执行完毕后置为RBTREE_COMBINING_IDLE */
+    RBTreeElemType key;        /* 操作的键 */
+    Status result;             /* 操作的结果, op变为空闲后有效 */
+    char pad[RBTREE_CACHE_LINE - sizeof(int) - sizeof(RBTreeElemType) - sizeof(Status)];
+} RBTreeCacheAligned RBTreeCombiningSlot;
+
+/* 平面合并的并发红黑树, 持有合并者锁的线程代替其他线程执行全部已发布的操作.
+ * 由RBTreeAlignedCalloc分配, 合并者写入的字段从新的缓存行开始, 不与其他线程反复尝试的锁共享 */
+typedef struct CombiningRBTree {
+    pthread_mutex_t lock;            /* 合并者锁 */
+    RBRoot *root;                    /* 被保护的红黑树 */
+    int threadCount;                 /* 已注册的线程数 */
+    unsigned long passes RBTreeCacheAligned; /* 合并的趟数 */
+    unsigned long combined;          /* 合并执行的操作数, 与passes之比为平均每趟的操作数 */
+    int pending[RBTREE_COMBINING_MAX_THREADS]; /* 一趟合并收集的槽位, 只由合并者使用 */
+    RBTreeCombiningSlot slots[RBTREE_COMBINING_MAX_THREADS];
+} CombiningRBTree;
+
+/* 创建平面合并的并发红黑树 */
+CombiningRBTree *createCombiningRBTree(RBTreeAllocator *allocator);
+
+/* 销毁平面合并的并发红黑树 */
+Status destroyCombiningRBTree(CombiningRBTree *tree);
+
+/* 注册线程 */
+int registerCombiningRBTreeThread(CombiningRBTree *tree);
+
+/* 平面合并的并发红黑树插入结点 */
+Status insertCombiningRBTree(CombiningRBTree *tree, int thread, RBTreeElemType x);
+
+/* 平面合并的并发红黑树删除结点 */
+Status deleteCombiningRBTree(CombiningRBTree *tree, int thread, RBTreeElemType x);
+
+/* 平面合并的并发红黑树查找结点 */
+Status searchCombiningRBTree(CombiningRBTree *tree, int thread, RBTreeElemType x);
+
+#endif /* RBTREE_COMBINING */
+
+#endif /* COMBININGRBTREE_H */
@@ -0,0 +1,73 @@
+/**
+ * @filename ConcurrentRBTree.h
+ * @description Red-Black tree with a single writer and lock-free readers interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef CONCURRENTRBTREE_H
+#define CONCURRENTRBTREE_H
+
+#if RBTREE_CONCURRENT_READERS
+
+#include <pthread.h>
+
+#define RBTREE_MAX_READERS   128  /* 可注册的读者线程数上限 */
+#define RBTREE_MAX_DEPTH     128  /* 读者单次下降的最大深度, 超过说明与写者交错, 需要重试 */
+#define RBTREE_READ_RETRIES  8    /* 读者连续重试该次数后让出处理器 */
+#define RBTREE_RECLAIM_BATCH 64   /* 待回收结点达到该数量时写者尝试推进纪元 */
+
+/* 读者槽位, 独占一个缓存行避免伪共享 */
+typedef struct RBTreeReaderSlot {
+    unsigned long epoch;  /* (所处纪元 << 1) | 1, 为0表示不在读临界区 */
+    char pad[RBTREE_CACHE_LINE - sizeof(unsigned long)];
+} RBTreeCacheAligned RBTreeReaderSlot;
+
+/* 某一纪元内被删除, 等待宽限期结束后回收的结点 */
+typedef struct RBTreeRetireList {
+    Node **nodes;
+    int count;
+    int capacity;
+} RBTreeRetireList;
+
+/* 单写者多读者的并发红黑树, 由RBTreeAlignedCalloc分配, 读者槽位各占一个完整的缓存行 */
+typedef struct ConcurrentRBTree {
+    unsigned long sequence;          /* 写序号, 为奇数表示写者正在修改树 */
+    unsigned long epoch;             /* 全局纪元 */
+    char pad[RBTREE_CACHE_LINE - 2 * sizeof(unsigned long)];
+    RBRoot *root;                    /* 被保护的红黑树 */
+    RBTreeAllocator allocator;       /* 延迟回收分配器, 绑定到root上 */
+    RBTreeAllocator *backing;        /* 实际分配结点的分配器, NULL表示malloc/free */
+    pthread_mutex_t writeLock;       /* 写者互斥锁 */
+    int readerCount;                 /* 已注册的读者数 */
+    int pending;                     /* 待回收的结点数 */
+    RBTreeRetireList retired[3];     /* 按纪元模3存放的待回收结点 */
+    RBTreeReaderSlot readers[RBTREE_MAX_READERS];
+} ConcurrentRBTree;
+
+/* 创建并发红黑树 */
+ConcurrentRBTree *createConcurrentRBTree(RBTreeAllocator *allocator);
+
+/* 销毁并发红黑树 */
+Status destroyConcurrentRBTree(ConcurrentRBTree *tree);
+
+/* 注册读者线程 */
+int registerConcurrentRBTreeReader(ConcurrentRBTree *tree);
+
+/* 无锁查找并发红黑树 */
+Status searchConcurrentRBTree(ConcurrentRBTree *tree, int reader, RBTreeElemType x);
+
+/* 并发红黑树插入结点 */
+Status insertConcurrentRBTree(ConcurrentRBTree *tree, RBTreeElemType x);
+
+/* 并发红黑树删除结点 */
+Status deleteConcurrentRBTree(ConcurrentRBTree *tree, RBTreeElemType x);
+
+/* 等待宽限期结束并回收全部已删除的结点 */
+Status synchronizeConcurrentRBTree(ConcurrentRBTree *tree);
+
+#endif /* RBTREE_CONCURRENT_READERS */
+
+#endif /* CONCURRENTRBTREE_H */
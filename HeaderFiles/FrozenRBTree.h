@@ -0,0 +1,40 @@
+/**
+ * @filename FrozenRBTree.h
+ * @description Frozen read-only Red-Black tree in implicit Eytzinger layout interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef FROZENRBTREE_H
+#define FROZENRBTREE_H
+
+#define RBTREE_FROZEN_ALIGN 64 /* 数组按缓存行对齐, 使同一结点的16个第4代后代落在同一缓存行 */
+
+/* 冻结的只读红黑树, 键按Eytzinger(层序)顺序存放在连续数组中 */
+typedef struct FrozenRBTree {
+    RBTreeElemType *keys;  /* keys[1]为根, keys[k]的孩子为keys[2k]和keys[2k + 1], keys[0]不使用 */
+    int size;              /* 键数 */
+    void *memory;          /* 对齐前分配的内存 */
+#if RBTREE_MULTISET
+    int *counts;           /* 按中序存放各键的个数, 解冻时恢复 */
+#endif
+} FrozenRBTree;
+
+/* 将红黑树冻结为只读的隐式布局 */
+FrozenRBTree *freezeRBTree(RBRoot *root);
+
+/* 将冻结的红黑树解冻为可修改的红黑树 */
+Status thawFrozenRBTree(FrozenRBTree *frozen, RBRoot *root);
+
+/* 销毁冻结的红黑树 */
+Status destroyFrozenRBTree(FrozenRBTree *frozen);
+
+/* 冻结的红黑树查找键 */
+Status searchFrozenRBTree(FrozenRBTree *frozen, RBTreeElemType x);
+
+/* 冻结的红黑树查找第一个不小于x的键 */
+Status lowerBoundFrozenRBTree(FrozenRBTree *frozen, RBTreeElemType x, RBTreeElemType *result);
+
+#endif /* FROZENRBTREE_H */
@@ -0,0 +1,58 @@
+/**
+ * @filename IndexedRBTree.h
+ * @description Red-Black tree with 32-bit index links interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef INDEXEDRBTREE_H
+#define INDEXEDRBTREE_H
+
+typedef unsigned int RBTreeIndex;
+
+#define RBTREE_NIL 0 /* 哨兵结点的下标, 表示空链接 */
+
+#define IndexedRBTreeData(t, i) ((t)->nodes[i].data)
+
+/* 以下标代替指针的紧凑结点, 16字节 */
+typedef struct IndexedNode {
+    RBTreeElemType data;     /* 数据域 */
+    RBTreeIndex left;        /* 左孩子结点下标 */
+    RBTreeIndex right;       /* 右孩子结点下标 */
+    RBTreeIndex parentColor; /* 父结点下标左移一位, 最低位为颜色 */
+} IndexedNode;
+
+/* 结点存放在连续数组中的红黑树 */
+typedef struct IndexedRBTree {
+    IndexedNode *nodes;   /* 结点数组, nodes[0]是黑色哨兵结点 */
+    RBTreeIndex root;     /* 根结点下标 */
+    RBTreeIndex freeList; /* 空闲结点链表, 借用right链接 */
+    RBTreeIndex used;     /* 已使用过的下标上界 */
+    RBTreeIndex capacity; /* 结点数组容量 */
+    int count;            /* 结点数 */
+} IndexedRBTree;
+
+/* 创建下标链接的红黑树 */
+IndexedRBTree *createIndexedRBTree(int capacity);
+
+/* 销毁下标链接的红黑树 */
+Status destroyIndexedRBTree(IndexedRBTree *tree);
+
+/* 查找结点下标 */
+RBTreeIndex searchIndexedRBTree(IndexedRBTree *tree, RBTreeElemType x);
+
+/* 插入结点 */
+Status insertIndexedRBTree(IndexedRBTree *tree, RBTreeElemType x);
+
+/* 删除结点 */
+Status deleteIndexedRBTree(IndexedRBTree *tree, RBTreeElemType x);
+
+/* 查找最小结点下标 */
+RBTreeIndex minIndexedRBTree(IndexedRBTree *tree);
+
+/* 查找后继结点下标 */
+RBTreeIndex nextIndexedRBTree(IndexedRBTree *tree, RBTreeIndex i);
+
+#endif /* INDEXEDRBTREE_H */
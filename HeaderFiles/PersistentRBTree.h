@@ -0,0 +1,68 @@
+/**
+ * @filename PersistentRBTree.h
+ * @description Persistent (path-copying) Red-Black tree interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef PERSISTENTRBTREE_H
+#define PERSISTENTRBTREE_H
+
+#define RBTREE_PERSISTENT_MAX_HEIGHT 128 /* 查找路径的最大长度, 结点数不超过INT_MAX时红黑树高度不超过62 */
+
+/* 持久化红黑树的结点, 没有父结点指针, 可以被多个版本共享 */
+typedef struct PersistentRBTreeNode {
+    RBTreeElemType data;                 /* 数据域 */
+    char color;                          /* 颜色 */
+    int refCount;                        /* 引用该结点的父结点和版本数 */
+    struct PersistentRBTreeNode *left;   /* 左孩子结点 */
+    struct PersistentRBTreeNode *right;  /* 右孩子结点 */
+} PersistentNode;
+
+/* 持久化红黑树的当前版本, 只能由一个写者线程修改 */
+typedef struct PersistentRBTree {
+    PersistentNode *root;  /* 当前版本的根结点 */
+    int size;              /* 结点数 */
+    PersistentNode *spare; /* 预留的空闲结点链表, 借用left链接, 保证写操作中途不会分配失败 */
+    int spareCount;        /* 预留的空闲结点数 */
+} PersistentRBTree;
+
+/* 持久化红黑树的只读快照, 可以在任意线程读取和释放 */
+typedef struct PersistentRBTreeSnapshot {
+    PersistentNode *root;  /* 快照的根结点 */
+    int size;              /* 结点数 */
+} PersistentRBTreeSnapshot;
+
+/* 遍历快照时的回调, 返回非0时提前终止遍历 */
+typedef int (*PersistentRBTreeVisitFunc)(RBTreeElemType data, void *arg);
+
+/* 创建持久化红黑树 */
+PersistentRBTree *createPersistentRBTree();
+
+/* 销毁持久化红黑树 */
+Status destroyPersistentRBTree(PersistentRBTree *tree);
+
+/* 持久化红黑树查找结点 */
+Status searchPersistentRBTree(PersistentRBTree *tree, RBTreeElemType x);
+
+/* 持久化红黑树插入结点 */
+Status insertPersistentRBTree(PersistentRBTree *tree, RBTreeElemType x);
+
+/* 持久化红黑树删除结点 */
+Status deletePersistentRBTree(PersistentRBTree *tree, RBTreeElemType x);
+
+/* 以O(1)时间获取当前版本的快照 */
+PersistentRBTreeSnapshot *snapshotPersistentRBTree(PersistentRBTree *tree);
+
+/* 释放快照 */
+Status releasePersistentRBTreeSnapshot(PersistentRBTreeSnapshot *snapshot);
+
+/* 快照中查找结点 */
+Status searchPersistentRBTreeSnapshot(PersistentRBTreeSnapshot *snapshot, RBTreeElemType x);
+
+/* 按从小到大的顺序遍历快照 */
+Status visitPersistentRBTreeSnapshot(PersistentRBTreeSnapshot *snapshot, PersistentRBTreeVisitFunc visit, void *arg);
+
+#endif /* PERSISTENTRBTREE_H */
@@ -0,0 +1,34 @@
+/**
+ * @filename RBTreeCursor.h
+ * @description Red-Black tree cursor interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef RBTREECURSOR_H
+#define RBTREECURSOR_H
+
+/* 红黑树游标, node为NULL表示游标越界 */
+typedef struct RBTreeCursor {
+    RBRoot *root; /* 游标所在的红黑树 */
+    Node *node;   /* 游标当前指向的结点 */
+} RBTreeCursor;
+
+/* 游标定位到最小结点 */
+Status firstRBTreeCursor(RBTreeCursor *cursor, RBRoot *root);
+
+/* 游标定位到最大结点 */
+Status lastRBTreeCursor(RBTreeCursor *cursor, RBRoot *root);
+
+/* 游标定位到第一个不小于x的结点 */
+Status seekRBTreeCursor(RBTreeCursor *cursor, RBRoot *root, RBTreeElemType x);
+
+/* 游标移动到后继结点 */
+Status nextRBTreeCursor(RBTreeCursor *cursor);
+
+/* 游标移动到前驱结点 */
+Status prevRBTreeCursor(RBTreeCursor *cursor);
+
+#endif /* RBTREECURSOR_H */
@@ -0,0 +1,53 @@
+/**
+ * @filename RBTreeFile.h
+ * @description Red-Black tree binary dump and reload interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include <stddef.h>
+#include "RedBlackTree.h"
+
+#ifndef RBTREEFILE_H
+#define RBTREEFILE_H
+
+#define RBTREE_FILE_MAGIC "RBTS"     /* 文件头魔数 */
+#define RBTREE_FILE_VERSION 1        /* 文件格式版本 */
+#define RBTREE_FILE_VERSION_COUNTS 2 /* 每个键之后记录其个数的多重集合文件格式版本 */
+#define RBTREE_FILE_BUFFER 65536     /* 导出时的写缓冲区大小 */
+
+/* zigzag编码, 绝对值小的负数也只占很少的varint字节 */
+#define RBTreeZigzagEncode(x) (((unsigned int) (x) << 1) ^ (unsigned int) -((x) < 0))
+#define RBTreeZigzagDecode(v) ((int) (((v) >> 1) ^ (0u - ((v) & 1))))
+
+/* 导出时取出结点附带的值, 写入value指向的valueSize字节 */
+typedef void (*RBTreeDumpValueFunc)(Node *node, void *value, void *arg);
+
+/* 载入时把valueSize字节的值交给新建的结点 */
+typedef void (*RBTreeLoadValueFunc)(Node *node, const void *value, void *arg);
+
+/* 计算CRC-32, crc为之前数据的结果, 首次传0 */
+unsigned int RBTreeCrc32(unsigned int crc, const void *data, size_t n);
+
+/* 将v编码为varint写入out, 返回字节数(至多5) */
+int RBTreeEncodeVarint(unsigned char *out, unsigned int v);
+
+/* 从[*p, end)解码一个varint, 成功时返回1并前移*p */
+int RBTreeDecodeVarint(const unsigned char **p, const unsigned char *end, unsigned int *v);
+
+/* 将整个文件读入内存 */
+unsigned char *RBTreeReadFile(const char *filename, long *size);
+
+/* 将红黑树导出到文件 */
+Status dumpRBTree(RBRoot *root, const char *filename);
+
+/* 由文件载入红黑树 */
+Status loadRBTree(RBRoot *root, const char *filename);
+
+/* 将红黑树连同结点附带的值导出到文件 */
+Status dumpRBTreeWithValues(RBRoot *root, const char *filename, int valueSize, RBTreeDumpValueFunc dump, void *arg);
+
+/* 由文件载入红黑树和结点附带的值 */
+Status loadRBTreeWithValues(RBRoot *root, const char *filename, int valueSize, RBTreeLoadValueFunc load, void *arg);
+
+#endif /* RBTREEFILE_H */
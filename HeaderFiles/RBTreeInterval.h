@@ -0,0 +1,46 @@
+/**
+ * @filename RBTreeInterval.h
+ * @description Red-Black interval tree interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef RBTREEINTERVAL_H
+#define RBTREEINTERVAL_H
+
+#if RBTREE_INTERVAL
+
+/*
+ * 区间树模式下左端点可以重复, 按数据域操作的接口只看左端点:
+ *   insertRBTree, insertOrFindRBTree, insertHintRBTree和upsertRBTree插入单点区间[x, x],
+ *   已有以x为左端点的区间时视为已存在; deleteRBTree, searchRBTreeNode, searchHintRBTree和
+ *   searchBatchRBTree作用于任意一个以x为左端点的区间; applyBatchRBTree的插入和删除分别与之相同.
+ *   区间应使用本文件的接口插入, 删除和查找.
+ * 要求键互不相同或不保存右端点的接口直接返回FAILED或NULL:
+ *   joinRBTree, splitRBTree, unionRBTree, intersectRBTree, differenceRBTree,
+ *   dumpRBTree, loadRBTree及其带值的版本, freezeRBTree和openRBTreeJournal.
+ */
+
+/* 区间树插入闭区间 */
+Status insertIntervalRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi);
+
+/* 区间树删除闭区间 */
+Status deleteIntervalRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi);
+
+/* 区间树查找闭区间 */
+RBTree searchIntervalRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi);
+
+/* 区间树查找任意一个与[lo, hi]重叠的区间 */
+RBTree findOverlapRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi);
+
+/* 区间树按左端点顺序遍历所有与[lo, hi]重叠的区间 */
+int overlapRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi, RBTreeVisitFunc visit, void *arg);
+
+/* 区间树按左端点顺序遍历所有包含t的区间 */
+int stabRBTree(RBRoot *root, RBTreeElemType t, RBTreeVisitFunc visit, void *arg);
+
+#endif /* RBTREE_INTERVAL */
+
+#endif /* RBTREEINTERVAL_H */
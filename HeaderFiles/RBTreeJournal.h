@@ -0,0 +1,60 @@
+/**
+ * @filename RBTreeJournal.h
+ * @description Red-Black tree write-ahead log interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include <stdio.h>
+#include "RedBlackTree.h"
+
+#ifndef RBTREEJOURNAL_H
+#define RBTREEJOURNAL_H
+
+#define RBTREE_JOURNAL_MAGIC "RBTJ"             /* 日志文件头魔数 */
+#define RBTREE_JOURNAL_VERSION 1                /* 日志格式版本 */
+#define RBTREE_JOURNAL_MIN_CHECKPOINT 65536     /* 自动检查点的最小操作数 */
+
+/* 日志记录的操作种类 */
+typedef enum {
+    RBTREE_JOURNAL_INSERT = 1,
+    RBTREE_JOURNAL_DELETE = 2
+} RBTreeJournalOp;
+
+/* 带预写日志的红黑树, 只能由一个线程使用 */
+typedef struct RBTreeJournal {
+    RBRoot *root;             /* 被记录的红黑树 */
+    char *logFile;            /* 日志文件名 */
+    char *checkpointFile;     /* 检查点文件名 */
+    FILE *log;                /* 以追加方式打开的日志文件 */
+    unsigned char *buffer;    /* 尚未提交的操作记录 */
+    size_t length;            /* 尚未提交的记录字节数 */
+    size_t capacity;          /* 记录缓冲区容量 */
+    int pending;              /* 尚未提交的操作数 */
+    int groupSize;            /* 累计到该操作数时自动提交 */
+    int checkpointInterval;   /* 自上次检查点提交到该操作数时自动做检查点, <= 0表示按树的大小自动决定 */
+    int sinceCheckpoint;      /* 自上次检查点已提交的操作数 */
+    int size;                 /* 红黑树的结点数 */
+    int broken;               /* 日志写入失败后不再接受操作 */
+} RBTreeJournal;
+
+/* 打开日志, 由检查点和日志尾部恢复红黑树 */
+RBTreeJournal *openRBTreeJournal(RBRoot *root, const char *logFile, const char *checkpointFile,
+                                 int groupSize, int checkpointInterval);
+
+/* 关闭日志, 提交尚未提交的操作 */
+Status closeRBTreeJournal(RBTreeJournal *journal);
+
+/* 插入结点并记录日志 */
+Status insertRBTreeJournal(RBTreeJournal *journal, RBTreeElemType x);
+
+/* 删除结点并记录日志 */
+Status deleteRBTreeJournal(RBTreeJournal *journal, RBTreeElemType x);
+
+/* 提交尚未提交的操作 */
+Status commitRBTreeJournal(RBTreeJournal *journal);
+
+/* 写出完整的检查点并清空日志 */
+Status checkpointRBTreeJournal(RBTreeJournal *journal);
+
+#endif /* RBTREEJOURNAL_H */
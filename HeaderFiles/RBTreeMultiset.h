@@ -0,0 +1,29 @@
+/**
+ * @filename RBTreeMultiset.h
+ * @description Red-Black tree multiset interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef RBTREEMULTISET_H
+#define RBTREEMULTISET_H
+
+#if RBTREE_MULTISET
+
+/* 多重集合中键的个数增加delta */
+int addMultiRBTree(RBRoot *root, RBTreeElemType x, int delta);
+
+/* 多重集合插入一个键 */
+Status insertMultiRBTree(RBRoot *root, RBTreeElemType x);
+
+/* 多重集合删除一个键 */
+Status deleteMultiRBTree(RBRoot *root, RBTreeElemType x);
+
+/* 多重集合中键的个数 */
+int countMultiRBTree(RBRoot *root, RBTreeElemType x);
+
+#endif /* RBTREE_MULTISET */
+
+#endif /* RBTREEMULTISET_H */
@@ -0,0 +1,42 @@
+/**
+ * @filename RBTreeNodePool.h
+ * @description Red-Black tree node pool interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef RBTREENODEPOOL_H
+#define RBTREENODEPOOL_H
+
+#define RBTREE_POOL_DEFAULT_CHUNK 4096 /* 默认每个内存块容纳的结点数 */
+
+/* 结点池的内存块 */
+typedef struct RBTreePoolChunk {
+    struct RBTreePoolChunk *next; /* 下一个内存块 */
+    Node nodes[];                 /* 连续存放的结点 */
+} RBTreePoolChunk;
+
+/* 红黑树结点池 */
+typedef struct RBTreeNodePool {
+    RBTreeAllocator allocator; /* 绑定到红黑树的分配器接口 */
+    RBTreePoolChunk *chunks;   /* 内存块链表, 表头为当前内存块 */
+    Node *freeList;            /* 侵入式空闲链表, 借用结点的right指针 */
+    int chunkCapacity;         /* 每个内存块容纳的结点数 */
+    int used;                  /* 当前内存块已分配的结点数 */
+} RBTreeNodePool;
+
+/* 创建结点池 */
+RBTreeNodePool *createRBTreeNodePool(int chunkCapacity);
+
+/* 从结点池分配结点 */
+Node *allocRBTreeNodePool(RBTreeNodePool *pool);
+
+/* 将结点归还结点池 */
+Status freeRBTreeNodePool(RBTreeNodePool *pool, Node *node);
+
+/* 销毁结点池 */
+Status destroyRBTreeNodePool(RBTreeNodePool *pool);
+
+#endif /* RBTREENODEPOOL_H */
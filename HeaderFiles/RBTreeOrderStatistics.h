@@ -0,0 +1,34 @@
+/**
+ * @filename RBTreeOrderStatistics.h
+ * @description Red-Black tree order statistics interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef RBTREEORDERSTATISTICS_H
+#define RBTREEORDERSTATISTICS_H
+
+#if RBTREE_ORDER_STATISTICS
+
+#define RBTreeSize(r) ((r) ? (r)->size : 0)
+
+/* 红黑树的结点数 */
+int sizeRBTree(RBRoot *root);
+
+/* 红黑树中小于x的结点数 */
+int rankRBTree(RBRoot *root, RBTreeElemType x);
+
+/* 红黑树中第k小的结点(从0计) */
+RBTree selectRBTree(RBRoot *root, int k);
+
+/* 红黑树中位于[lo, hi)的结点数 */
+int countRangeRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi);
+
+/* 红黑树的百分位数 */
+Status percentileRBTree(RBRoot *root, double percent, RBTreeElemType *x);
+
+#endif /* RBTREE_ORDER_STATISTICS */
+
+#endif /* RBTREEORDERSTATISTICS_H */
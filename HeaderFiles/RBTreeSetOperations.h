@@ -0,0 +1,30 @@
+/**
+ * @filename RBTreeSetOperations.h
+ * @description Red-Black tree join, split and set operations interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef RBTREESETOPERATIONS_H
+#define RBTREESETOPERATIONS_H
+
+#define RBTREE_PARALLEL_MIN_HEIGHT 8 /* 子树黑高不小于该值时才分派给新线程 */
+
+/* 以x连接两棵红黑树 */
+Status joinRBTree(RBRoot *left, RBTreeElemType x, RBRoot *right);
+
+/* 按x分裂红黑树 */
+Status splitRBTree(RBRoot *root, RBTreeElemType x, RBRoot *greater);
+
+/* 红黑树的并集 */
+Status unionRBTree(RBRoot *a, RBRoot *b, int threads);
+
+/* 红黑树的交集 */
+Status intersectRBTree(RBRoot *a, RBRoot *b, int threads);
+
+/* 红黑树的差集 */
+Status differenceRBTree(RBRoot *a, RBRoot *b, int threads);
+
+#endif /* RBTREESETOPERATIONS_H */
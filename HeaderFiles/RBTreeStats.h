@@ -0,0 +1,30 @@
+/**
+ * @filename RBTreeStats.h
+ * @description Red-Black tree statistics interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef RBTREESTATS_H
+#define RBTREESTATS_H
+
+/* 红黑树的统计信息 */
+typedef struct RBTreeStats {
+    RBTreeCounters counters;  /* 操作计数器, 未启用RBTREE_STATS时全为0 */
+    long nodes;               /* 结点数 */
+    int height;               /* 高度, 即最长路径上的结点数 */
+    int blackHeight;          /* 黑高, 即任一路径上的黑色结点数 */
+    size_t liveBytes;         /* 结点占用的字节数 */
+    size_t reservedBytes;     /* 分配器已申请的字节数, 分配器不提供时等于liveBytes */
+    double fragmentation;     /* 碎片率, 即已申请但未被结点占用的比例 */
+} RBTreeStats;
+
+/* 获取红黑树的统计信息 */
+Status getRBTreeStats(RBRoot *root, RBTreeStats *stats);
+
+/* 清零红黑树的操作计数器 */
+Status resetRBTreeStats(RBRoot *root);
+
+#endif /* RBTREESTATS_H */
@@ -8,43 +8,235 @@
 #ifndef RBTREE_H
 #define RBTREE_H
 
+#include <stddef.h>
+
+/* 编译选项: 结点维护子树大小, 支持O(log n)的排名和选择查询 */
+#ifndef RBTREE_ORDER_STATISTICS
+#define RBTREE_ORDER_STATISTICS 0
+#endif
+
+/* 编译选项: 区间树, 结点表示以数据域为左端点的闭区间, 维护子树中最大的右端点, 支持重叠查询.
+ * 此模式下不适用的接口见RBTreeInterval.h */
+#ifndef RBTREE_INTERVAL
+#define RBTREE_INTERVAL 0
+#endif
+
+/* 结点是否带有需要随结构变化维护的附加信息 */
+#define RBTREE_AUGMENTED (RBTREE_ORDER_STATISTICS || RBTREE_INTERVAL)
+
+/* 编译选项: 紧凑结点, 颜色存放在父结点指针的最低位 */
+#ifndef RBTREE_COMPACT_NODE
+#define RBTREE_COMPACT_NODE 0
+#endif
+
+/* 编译选项: 并发读模式, 单写者以release语义发布孩子指针, 读者无锁遍历 */
+#ifndef RBTREE_CONCURRENT_READERS
+#define RBTREE_CONCURRENT_READERS 0
+#endif
+
+/* 编译选项: 按键范围分片的红黑树容器, 依赖pthread */
+#ifndef RBTREE_SHARDED
+#define RBTREE_SHARDED 0
+#endif
+
+/* 编译选项: 集合运算的两个子问题分派到多个线程并行执行, 依赖pthread */
+#ifndef RBTREE_PARALLEL
+#define RBTREE_PARALLEL 0
+#endif
+
+/* 编译选项: 多重集合, 结点记录键的重复次数, 重复的键不会产生新结点 */
+#ifndef RBTREE_MULTISET
+#define RBTREE_MULTISET 0
+#endif
+
+/* 编译选项: 每棵红黑树维护旋转, 重新着色, 自平衡循环和查找比较次数等操作计数器 */
+#ifndef RBTREE_STATS
+#define RBTREE_STATS 0
+#endif
+
+/* 编译选项: 平面合并的并发红黑树, 持有锁的线程代替其他线程成批执行写操作, 依赖pthread */
+#ifndef RBTREE_COMBINING
+#define RBTREE_COMBINING 0
+#endif
+
+#define RBTREE_SEARCH_BATCH_WIDTH 16 /* 批量查找同时进行的查找数, 即同时在途的缓存缺失数 */
+
 #define RED   0 /* 红色结点标志 */
 #define BLACK 1 /* 黑色结点标志 */
 
+#if RBTREE_COMPACT_NODE
+#include <stdint.h>
+#define RBTreeColor(r) ((int) ((r)->parentColor & 1))
+#define RBTreeParent(r) ((struct RBTreeNode *) ((r)->parentColor & ~(uintptr_t) 1))
+#define RBTreeSetColor(r, c) do {(r)->parentColor = ((r)->parentColor & ~(uintptr_t) 1) | (uintptr_t) (c);} while(0)
+#define RBTreeSetParent(r, p) do {(r)->parentColor = (uintptr_t) (p) | ((r)->parentColor & 1);} while(0)
+#define RBTreeSetParentColor(r, p, c) do {(r)->parentColor = (uintptr_t) (p) | (uintptr_t) (c);} while(0)
+#else
 #define RBTreeColor(r) ((r)->color)
 #define RBTreeParent(r) ((r)->parent)
-#define RBTreeIsRed(r) ((r)->color == RED)
-#define RBTreeIsBlack(r) ((r)->color == BLACK)
 #define RBTreeSetColor(r, c) do {(r)->color = (c);} while(0)
 #define RBTreeSetParent(r, p) do {(r)->parent = (p);} while(0)
-#define RBTreeSetRed(r) do {(r)->color = RED;} while(0)
-#define RBTreeSetBlack(r) do {(r)->color = BLACK;} while(0)
+#define RBTreeSetParentColor(r, p, c) do {(r)->parent = (p); (r)->color = (c);} while(0)
+#endif
+#define RBTreeIsRed(r) (RBTreeColor(r) == RED)
+#define RBTreeIsBlack(r) (RBTreeColor(r) == BLACK)
+#define RBTreeSetRed(r) RBTreeSetColor(r, RED)
+#define RBTreeSetBlack(r) RBTreeSetColor(r, BLACK)
+
+/* 结点所代表的键的个数, 非多重集合模式下恒为1 */
+#if RBTREE_MULTISET
+#define RBTreeMultiplicity(r) ((r)->count)
+#else
+#define RBTreeMultiplicity(r) 1
+#endif
+
+/* 孩子指针和根指针的写入与读取, 并发读模式下保证读者看到的新结点已完整初始化 */
+#if RBTREE_CONCURRENT_READERS
+#define RBTreeStoreLink(link, p) __atomic_store_n(&(link), (p), __ATOMIC_RELEASE)
+#define RBTreeLoadLink(link) __atomic_load_n(&(link), __ATOMIC_ACQUIRE)
+#else
+#define RBTreeStoreLink(link, p) ((link) = (p))
+#define RBTreeLoadLink(link) (link)
+#endif
+
+/* 预取p所在的缓存行, 编译器不支持时为空操作 */
+#if defined(__GNUC__) || defined(__clang__)
+#define RBTreePrefetch(p) __builtin_prefetch(p)
+#else
+#define RBTreePrefetch(p) ((void) (p))
+#endif
+
+#ifndef RBTREE_CACHE_LINE
+#define RBTREE_CACHE_LINE 64 /* 缓存行大小 */
+#endif
+
+/* 类型按缓存行对齐, 编译器不支持时为空, 只依靠填充避免伪共享 */
+#if defined(__GNUC__) || defined(__clang__)
+#define RBTreeCacheAligned __attribute__((aligned(RBTREE_CACHE_LINE)))
+#else
+#define RBTreeCacheAligned
+#endif
 
 typedef int RBTreeElemType;
 
 /* 红黑树的结点 */
 typedef struct RBTreeNode {
     RBTreeElemType data;       /* 数据域 */
+#if !RBTREE_COMPACT_NODE
     char color;                /* 颜色 */
+#endif
+#if RBTREE_ORDER_STATISTICS
+    int size;                  /* 以该结点为根的子树的结点数, 多重集合模式下为键的总个数 */
+#endif
+#if RBTREE_MULTISET
+    int count;                 /* 键的重复次数 */
+#endif
+#if RBTREE_INTERVAL
+    RBTreeElemType hi;         /* 区间的右端点, 区间为[data, hi] */
+    RBTreeElemType maxHi;      /* 以该结点为根的子树中最大的右端点 */
+#endif
     struct RBTreeNode *left;   /* 左孩子结点 */
     struct RBTreeNode *right;  /* 右孩子结点 */
+#if RBTREE_COMPACT_NODE
+    uintptr_t parentColor;     /* 父结点指针, 最低位为颜色 */
+#else
     struct RBTreeNode *parent; /* 父结点 */
+#endif
 } Node, *RBTree;
 
+/* 红黑树结点分配器, 绑定到红黑树的根结点上 */
+typedef struct RB_Allocator {
+    Node *(*allocNode)(void *context);             /* 分配一个结点 */
+    void (*freeNode)(void *context, Node *node);   /* 释放一个结点 */
+    void (*releaseAll)(void *context);             /* 一次性释放全部结点和分配器自身, 可为NULL */
+    size_t (*reservedBytes)(void *context);        /* 已向系统申请的字节数, 用于计算碎片率, 可为NULL */
+    void *context;                                 /* 分配器上下文 */
+} RBTreeAllocator;
+
+/* 红黑树的操作计数器, 自创建或上次清零以来累计 */
+typedef struct RB_Counters {
+    unsigned long long rotations;     /* 旋转次数 */
+    unsigned long long recolors;      /* 自平衡中改变结点颜色的次数 */
+    unsigned long long insertFixups;  /* 插入自平衡的循环次数 */
+    unsigned long long deleteFixups;  /* 删除自平衡的循环次数 */
+    unsigned long long searches;      /* 查找、插入和删除从根结点或提示结点下降的次数 */
+    unsigned long long comparisons;   /* 上述下降访问的结点数 */
+    unsigned long long allocations;   /* 分配的结点数 */
+    unsigned long long frees;         /* 释放的结点数 */
+} RBTreeCounters;
+
 /* 红黑树的根结点 */
 typedef struct RB_Root {
     Node *node;
+    RBTreeAllocator *allocator; /* 结点分配器, 为NULL时使用malloc/free */
+    Node *rightmost;            /* 最大结点, 递增的键直接挂在其右侧而无需从根结点下降 */
+#if RBTREE_STATS
+    RBTreeCounters counters;    /* 操作计数器 */
+#endif
 } RBRoot;
 
+/* 累加计数器, 写者独占红黑树时使用; 查找可能与其他读者并发, 使用RBTreeCountShared */
+#if RBTREE_STATS
+#define RBTreeCount(root, field, n) ((void) ((root)->counters.field += (n)))
+#if defined(__GNUC__) || defined(__clang__)
+#define RBTreeCountShared(root, field, n) ((void) __atomic_fetch_add(&(root)->counters.field, (n), __ATOMIC_RELAXED))
+#else
+#define RBTreeCountShared(root, field, n) RBTreeCount(root, field, n)
+#endif
+#else
+#define RBTreeCount(root, field, n) ((void) 0)
+#define RBTreeCountShared(root, field, n) ((void) 0)
+#endif
+
 /* 操作状态码 */
 typedef enum {
     SUCCESS = 0,
     FAILED = -1
 } Status;
 
+/* 插入或更新结点时的回调, inserted为1表示结点是新插入的 */
+typedef void (*RBTreeUpsertFunc)(Node *node, int inserted, void *arg);
+
+/* 遍历结点时的回调, 返回非0时提前终止遍历 */
+typedef int (*RBTreeVisitFunc)(Node *node, void *arg);
+
+/* 批量操作的种类 */
+typedef enum {
+    RBTREE_BATCH_INSERT = 0,
+    RBTREE_BATCH_DELETE = 1
+} RBTreeBatchType;
+
+/* 批量操作 */
+typedef struct RB_BatchOp {
+    RBTreeElemType key;        /* 键 */
+    RBTreeBatchType type;      /* 插入或删除 */
+} RBTreeBatchOp;
+
+/* 遍历方式 */
+typedef enum {
+    RBTREE_PREORDER = 0,
+    RBTREE_INORDER = 1,
+    RBTREE_POSTORDER = 2
+} RBTreeOrder;
+
 /* 创建红黑树 */
 RBRoot *createRBTree();
 
+/* 创建使用结点池分配结点的红黑树 */
+RBRoot *createPooledRBTree(int chunkCapacity);
+
+/* 设置红黑树的结点分配器 */
+Status setRBTreeAllocator(RBRoot *root, RBTreeAllocator *allocator);
+
+/* 由有序数组线性时间构建红黑树 */
+Status buildRBTreeFromSorted(RBRoot *root, const RBTreeElemType *keys, int n);
+
+/* 由严格递增的键及其个数线性时间构建红黑树 */
+Status buildRBTreeFromCounts(RBRoot *root, const RBTreeElemType *keys, const int *counts, int n);
+
+/* 由任意顺序的数组构建红黑树 */
+Status buildRBTree(RBRoot *root, const RBTreeElemType *keys, int n);
+
 /* 销毁红黑树 */
 Status destroyRBTree(RBRoot *root);
 
@@ -57,12 +249,48 @@ Status inorderRBTree(RBRoot *root);
 /* 后序遍历红黑树 */
 Status postorderRBTree(RBRoot *root);
 
+/* 以回调方式遍历红黑树 */
+Status visitRBTree(RBRoot *root, RBTreeOrder order, RBTreeVisitFunc visit, void *arg);
+
 /* 递归查找红黑树 */
 Status recursiveSearchRBTree(RBRoot *root, RBTreeElemType x);
 
 /* 红黑树插入结点 */
 Status insertRBTree(RBRoot *root, RBTreeElemType x);
 
+/* 红黑树查找结点 */
+RBTree searchRBTreeNode(RBRoot *root, RBTreeElemType x);
+
+/* 红黑树查找第一个不小于x的结点 */
+RBTree lowerBoundRBTree(RBRoot *root, RBTreeElemType x);
+
+/* 红黑树查找第一个大于x的结点 */
+RBTree upperBoundRBTree(RBRoot *root, RBTreeElemType x);
+
+/* 按顺序遍历红黑树中位于[lo, hi)的结点 */
+Status rangeRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi, RBTreeVisitFunc visit, void *arg);
+
+/* 红黑树删除位于[lo, hi)的全部结点 */
+int eraseRangeRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi);
+
+/* 红黑树查找或插入结点 */
+RBTree insertOrFindRBTree(RBRoot *root, RBTreeElemType x, int *inserted);
+
+/* 红黑树从提示结点出发查找结点 */
+RBTree searchHintRBTree(RBRoot *root, Node *hint, RBTreeElemType x);
+
+/* 红黑树交错地批量查找多个键 */
+int searchBatchRBTree(RBRoot *root, const RBTreeElemType *keys, int n, Node **results);
+
+/* 红黑树从提示结点出发查找或插入结点 */
+RBTree insertHintRBTree(RBRoot *root, Node *hint, RBTreeElemType x, int *inserted);
+
+/* 红黑树插入或更新结点 */
+Status upsertRBTree(RBRoot *root, RBTreeElemType x, RBTreeUpsertFunc update, void *arg);
+
+/* 按键有序地批量插入和删除 */
+Status applyBatchRBTree(RBRoot *root, const RBTreeBatchOp *ops, int n, int *applied);
+
 /* 红黑树删除结点 */
 Status deleteRBTree(RBRoot *root, RBTreeElemType x);
 
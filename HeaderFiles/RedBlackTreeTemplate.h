@@ -0,0 +1,370 @@
+/**
+ * @filename RedBlackTreeTemplate.h
+ * @description Type-specialized Red-Black tree instantiation macros
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * RBTREE_DEFINE(name, KeyType, ValueType, compare) 生成一棵完全特化的红黑树,
+ * compare(a, b) 在编译期展开, 返回负数/0/正数分别表示 a < b, a == b, a > b.
+ * compare 可以是函数式宏或 static inline 函数, 不经过函数指针调用.
+ *
+ * 示例:
+ *     #define U64Compare(a, b) RBTreeCompareScalar(a, b)
+ *     RBTREE_DEFINE(U64Tree, uint64_t, double, U64Compare)
+ *
+ *     U64TreeRoot *root = U64TreeCreate();
+ *     U64TreeUpsert(root, 42, 3.14);
+ *     U64TreeNode *node = U64TreeSearch(root, 42);
+ *     U64TreeDestroy(root);
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "RedBlackTree.h"
+
+#ifndef RBTREETEMPLATE_H
+#define RBTREETEMPLATE_H
+
+/* 标量类型的三路比较 */
+#define RBTreeCompareScalar(a, b) (((a) > (b)) - ((a) < (b)))
+
+#define RBTREE_DEFINE(name, KeyType, ValueType, compare)                                     \
+                                                                                             \
+/* 特化红黑树的结点 */                                                                        \
+typedef struct name##Node {                                                                  \
+    KeyType key;                   /* 键 */                                                  \
+    ValueType value;               /* 值 */                                                  \
+    char color;                    /* 颜色 */                                                \
+    struct name##Node *left;       /* 左孩子结点 */                                          \
+    struct name##Node *right;      /* 右孩子结点 */                                          \
+    struct name##Node *parent;     /* 父结点 */                                              \
+} name##Node;                                                                                \
+                                                                                             \
+/* 特化红黑树的根结点 */                                                                      \
+typedef struct name##Root {                                                                  \
+    name##Node *node;                                                                        \
+} name##Root;                                                                                \
+                                                                                             \
+/* 创建红黑树 */                                                                              \
+static inline name##Root *name##Create(void)                                                 \
+{                                                                                            \
+    name##Root *root = (name##Root *) malloc(sizeof(name##Root));                            \
+    if (root) root->node = NULL;                                                             \
+    return root;                                                                             \
+}                                                                                            \
+                                                                                             \
+/* 销毁红黑树, 通过旋转拉直后逐个释放, 不使用递归 */                                        \
+static inline Status name##Destroy(name##Root *root)                                         \
+{                                                                                            \
+    if (!root) return FAILED;                                                                \
+    name##Node *p = root->node, *next;                                                       \
+    while (p) {                                                                              \
+        if (p->left) {                                                                       \
+            next = p->left;                                                                  \
+            p->left = next->right;                                                           \
+            next->right = p;                                                                 \
+        } else {                                                                             \
+            next = p->right;                                                                 \
+            free(p);                                                                         \
+        }                                                                                    \
+        p = next;                                                                            \
+    }                                                                                        \
+    free(root);                                                                              \
+    return SUCCESS;                                                                          \
+}                                                                                            \
+                                                                                             \
+/* 查找键为key的结点 */                                                                       \
+static inline name##Node *name##Search(const name##Root *root, KeyType key)                  \
+{                                                                                            \
+    name##Node *p = root->node;                                                              \
+    while (p) {                                                                              \
+        int c = compare(key, p->key);                                                        \
+        if (c < 0) p = p->left;                                                              \
+        else if (c > 0) p = p->right;                                                        \
+        else return p;                                                                       \
+    }                                                                                        \
+    return NULL;                                                                             \
+}                                                                                            \
+                                                                                             \
+/* 查找最小结点 */                                                                            \
+static inline name##Node *name##Min(const name##Root *root)                                  \
+{                                                                                            \
+    name##Node *p = root->node;                                                              \
+    if (p) while (p->left) p = p->left;                                                      \
+    return p;                                                                                \
+}                                                                                            \
+                                                                                             \
+/* 查找最大结点 */                                                                            \
+static inline name##Node *name##Max(const name##Root *root)                                  \
+{                                                                                            \
+    name##Node *p = root->node;                                                              \
+    if (p) while (p->right) p = p->right;                                                    \
+    return p;                                                                                \
+}                                                                                            \
+                                                                                             \
+/* 查找后继结点 */                                                                            \
+static inline name##Node *name##Next(name##Node *node)                                       \
+{                                                                                            \
+    if (node->right) {                                                                       \
+        node = node->right;                                                                  \
+        while (node->left) node = node->left;                                                \
+        return node;                                                                         \
+    }                                                                                        \
+    name##Node *p = node->parent;                                                            \
+    while (p && node == p->right) {                                                          \
+        node = p;                                                                            \
+        p = p->parent;                                                                       \
+    }                                                                                        \
+    return p;                                                                                \
+}                                                                                            \
+                                                                                             \
+/* 查找前驱结点 */                                                                            \
+static inline name##Node *name##Prev(name##Node *node)                                       \
+{                                                                                            \
+    if (node->left) {                                                                        \
+        node = node->left;                                                                   \
+        while (node->right) node = node->right;                                              \
+        return node;                                                                         \
+    }                                                                                        \
+    name##Node *p = node->parent;                                                            \
+    while (p && node == p->left) {                                                           \
+        node = p;                                                                            \
+        p = p->parent;                                                                       \
+    }                                                                                        \
+    return p;                                                                                \
+}                                                                                            \
+                                                                                             \
+/* 结点左旋 */                                                                                \
+static inline void name##LeftRotate(name##Root *root, name##Node *node)                      \
+{                                                                                            \
+    name##Node *p = node->right;                                                             \
+    node->right = p->left;                                                                   \
+    if (p->left) p->left->parent = node;                                                     \
+    p->parent = node->parent;                                                                \
+    if (!node->parent) root->node = p;                                                       \
+    else if (node->parent->left == node) node->parent->left = p;                             \
+    else node->parent->right = p;                                                            \
+    p->left = node;                                                                          \
+    node->parent = p;                                                                        \
+}                                                                                            \
+                                                                                             \
+/* 结点右旋 */                                                                                \
+static inline void name##RightRotate(name##Root *root, name##Node *node)                     \
+{                                                                                            \
+    name##Node *p = node->left;                                                              \
+    node->left = p->right;                                                                   \
+    if (p->right) p->right->parent = node;                                                   \
+    p->parent = node->parent;                                                                \
+    if (!node->parent) root->node = p;                                                       \
+    else if (node->parent->right == node) node->parent->right = p;                           \
+    else node->parent->left = p;                                                             \
+    p->right = node;                                                                         \
+    node->parent = p;                                                                        \
+}                                                                                            \
+                                                                                             \
+/* 插入结点后自平衡 */                                                                        \
+static inline void name##InsertSelfBalancing(name##Root *root, name##Node *node)             \
+{                                                                                            \
+    name##Node *parent, *grandparent, *uncle;                                                \
+    while ((parent = node->parent) && parent->color == RED) {                                \
+        grandparent = parent->parent;                                                        \
+        if (parent == grandparent->left) {                                                   \
+            uncle = grandparent->right;                                                      \
+            if (uncle && uncle->color == RED) {                                              \
+                parent->color = BLACK;                                                       \
+                uncle->color = BLACK;                                                        \
+                grandparent->color = RED;                                                    \
+                node = grandparent;                                                          \
+                continue;                                                                    \
+            }                                                                                \
+            if (node == parent->right) {                                                     \
+                name##LeftRotate(root, parent);                                              \
+                node = parent;                                                               \
+                parent = node->parent;                                                       \
+            }                                                                                \
+            parent->color = BLACK;                                                           \
+            grandparent->color = RED;                                                        \
+            name##RightRotate(root, grandparent);                                            \
+        } else {                                                                             \
+            uncle = grandparent->left;                                                       \
+            if (uncle && uncle->color == RED) {                                              \
+                parent->color = BLACK;                                                       \
+                uncle->color = BLACK;                                                        \
+                grandparent->color = RED;                                                    \
+                node = grandparent;                                                          \
+                continue;                                                                    \
+            }                                                                                \
+            if (node == parent->left) {                                                      \
+                name##RightRotate(root, parent);                                             \
+                node = parent;                                                               \
+                parent = node->parent;                                                       \
+            }                                                                                \
+            parent->color = BLACK;                                                           \
+            grandparent->color = RED;                                                        \
+            name##LeftRotate(root, grandparent);                                             \
+        }                                                                                    \
+    }                                                                                        \
+    root->node->color = BLACK;                                                               \
+}                                                                                            \
+                                                                                             \
+/* 单次下降查找或插入键为key的结点, 新结点的值初始化为0 */                                    \
+static inline name##Node *name##InsertOrFind(name##Root *root, KeyType key, int *inserted)   \
+{                                                                                            \
+    name##Node *p = root->node, *parent = NULL;                                              \
+    int c = 0;                                                                               \
+    if (inserted) *inserted = 0;                                                             \
+    while (p) {                                                                              \
+        c = compare(key, p->key);                                                            \
+        if (c == 0) return p;                                                                \
+        parent = p;                                                                          \
+        p = c < 0 ? p->left : p->right;                                                      \
+    }                                                                                        \
+    p = (name##Node *) malloc(sizeof(name##Node));                                           \
+    if (!p) return NULL;                                                                     \
+    p->key = key;                                                                            \
+    memset(&p->value, 0, sizeof(p->value));                                                  \
+    p->color = RED;                                                                          \
+    p->left = p->right = NULL;                                                               \
+    p->parent = parent;                                                                      \
+    if (!parent) root->node = p;                                                             \
+    else if (c < 0) parent->left = p;                                                        \
+    else parent->right = p;                                                                  \
+    name##InsertSelfBalancing(root, p);                                                      \
+    if (inserted) *inserted = 1;                                                             \
+    return p;                                                                                \
+}                                                                                            \
+                                                                                             \
+/* 插入结点, 键已存在时失败 */                                                                \
+static inline Status name##Insert(name##Root *root, KeyType key, ValueType value)            \
+{                                                                                            \
+    int inserted;                                                                            \
+    name##Node *node = name##InsertOrFind(root, key, &inserted);                             \
+    if (!node || !inserted) return FAILED;                                                   \
+    node->value = value;                                                                     \
+    return SUCCESS;                                                                          \
+}                                                                                            \
+                                                                                             \
+/* 插入结点, 键已存在时更新其值 */                                                            \
+static inline Status name##Upsert(name##Root *root, KeyType key, ValueType value)            \
+{                                                                                            \
+    name##Node *node = name##InsertOrFind(root, key, NULL);                                  \
+    if (!node) return FAILED;                                                                \
+    node->value = value;                                                                     \
+    return SUCCESS;                                                                          \
+}                                                                                            \
+                                                                                             \
+/* 删除结点后自平衡 */                                                                        \
+static inline void name##DeleteSelfBalancing(name##Root *root, name##Node *node,             \
+                                             name##Node *parent)                             \
+{                                                                                            \
+    name##Node *sibling;                                                                     \
+    while ((!node || node->color == BLACK) && node != root->node) {                          \
+        if (node == parent->left) {                                                          \
+            sibling = parent->right;                                                         \
+            if (sibling->color == RED) {                                                     \
+                sibling->color = BLACK;                                                      \
+                parent->color = RED;                                                         \
+                name##LeftRotate(root, parent);                                              \
+                sibling = parent->right;                                                     \
+            }                                                                                \
+            if ((!sibling->left || sibling->left->color == BLACK) &&                         \
+                (!sibling->right || sibling->right->color == BLACK)) {                       \
+                sibling->color = RED;                                                        \
+                node = parent;                                                               \
+                parent = node->parent;                                                       \
+            } else {                                                                         \
+                if (!sibling->right || sibling->right->color == BLACK) {                     \
+                    sibling->left->color = BLACK;                                            \
+                    sibling->color = RED;                                                    \
+                    name##RightRotate(root, sibling);                                        \
+                    sibling = parent->right;                                                 \
+                }                                                                            \
+                sibling->color = parent->color;                                              \
+                parent->color = BLACK;                                                       \
+                sibling->right->color = BLACK;                                               \
+                name##LeftRotate(root, parent);                                              \
+                node = root->node;                                                           \
+                break;                                                                       \
+            }                                                                                \
+        } else {                                                                             \
+            sibling = parent->left;                                                          \
+            if (sibling->color == RED) {                                                     \
+                sibling->color = BLACK;                                                      \
+                parent->color = RED;                                                         \
+                name##RightRotate(root, parent);                                             \
+                sibling = parent->left;                                                      \
+            }                                                                                \
+            if ((!sibling->left || sibling->left->color == BLACK) &&                         \
+                (!sibling->right || sibling->right->color == BLACK)) {                       \
+                sibling->color = RED;                                                        \
+                node = parent;                                                               \
+                parent = node->parent;                                                       \
+            } else {                                                                         \
+                if (!sibling->left || sibling->left->color == BLACK) {                       \
+                    sibling->right->color = BLACK;                                           \
+                    sibling->color = RED;                                                    \
+                    name##LeftRotate(root, sibling);                                         \
+                    sibling = parent->left;                                                  \
+                }                                                                            \
+                sibling->color = parent->color;                                              \
+                parent->color = BLACK;                                                       \
+                sibling->left->color = BLACK;                                                \
+                name##RightRotate(root, parent);                                             \
+                node = root->node;                                                           \
+                break;                                                                       \
+            }                                                                                \
+        }                                                                                    \
+    }                                                                                        \
+    if (node) node->color = BLACK;                                                           \
+}                                                                                            \
+                                                                                             \
+/* 删除结点指针 */                                                                            \
+static inline Status name##DeleteNode(name##Root *root, name##Node *node)                    \
+{                                                                                            \
+    name##Node *child, *parent;                                                              \
+    int color;                                                                               \
+    if (node->left && node->right) {                                                         \
+        name##Node *replace = node->right;                                                   \
+        while (replace->left) replace = replace->left;                                       \
+        if (node->parent) {                                                                  \
+            if (node == node->parent->left) node->parent->left = replace;                    \
+            else node->parent->right = replace;                                              \
+        } else root->node = replace;                                                         \
+        child = replace->right;                                                              \
+        parent = replace->parent;                                                            \
+        color = replace->color;                                                              \
+        if (parent == node) parent = replace;                                                \
+        else {                                                                               \
+            if (child) child->parent = parent;                                               \
+            parent->left = child;                                                            \
+            replace->right = node->right;                                                    \
+            node->right->parent = replace;                                                   \
+        }                                                                                    \
+        replace->parent = node->parent;                                                      \
+        replace->color = node->color;                                                        \
+        replace->left = node->left;                                                          \
+        node->left->parent = replace;                                                        \
+    } else {                                                                                 \
+        child = node->left ? node->left : node->right;                                       \
+        parent = node->parent;                                                               \
+        color = node->color;                                                                 \
+        if (child) child->parent = parent;                                                   \
+        if (parent) {                                                                        \
+            if (node == parent->left) parent->left = child;                                  \
+            else parent->right = child;                                                      \
+        } else root->node = child;                                                           \
+    }                                                                                        \
+    if (color == BLACK) name##DeleteSelfBalancing(root, child, parent);                      \
+    free(node);                                                                              \
+    return SUCCESS;                                                                          \
+}                                                                                            \
+                                                                                             \
+/* 删除键为key的结点 */                                                                       \
+static inline Status name##Delete(name##Root *root, KeyType key)                             \
+{                                                                                            \
+    name##Node *node = name##Search(root, key);                                              \
+    if (!node) return FAILED;                                                                \
+    return name##DeleteNode(root, node);                                                     \
+}
+
+#endif /* RBTREETEMPLATE_H */
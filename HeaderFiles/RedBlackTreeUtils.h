@@ -8,8 +8,31 @@
 #ifndef RBTREEUTILS_H
 #define RBTREEUTILS_H
 
+#if RBTREE_AUGMENTED
+/* 由孩子结点重新计算结点的附加信息 */
+void RBTreeAugmentNode(Node *node);
+
+/* 从结点到根结点逐个重新计算附加信息 */
+void RBTreeAugmentPath(Node *node);
+#else
+#define RBTreeAugmentNode(node) ((void) 0)
+#define RBTreeAugmentPath(node) ((void) 0)
+#endif
+
+/* 分配按缓存行对齐并清零的内存 */
+void *RBTreeAlignedCalloc(size_t size);
+
+/* 释放RBTreeAlignedCalloc分配的内存 */
+void RBTreeAlignedFree(void *memory);
+
 /* 创建红黑树结点 */
-RBTree createRBTreeNode(RBTreeElemType x, Node *parent, Node *left, Node *right);
+RBTree createRBTreeNode(RBRoot *root, RBTreeElemType x, Node *parent, Node *left, Node *right);
+
+/* 释放红黑树结点 */
+Status freeRBTreeNode(RBRoot *root, Node *node);
+
+/* 通过分配器释放红黑树的全部结点 */
+Status destroyRBTreeNodes(RBRoot *root, RBTree tree);
 
 /* 红黑树插入结点后自平衡 */
 Status RBTreeInsertSelfBalancing(RBRoot *root, Node *node);
@@ -29,6 +52,9 @@ Status deleteRBTreeNode(RBRoot *root, Node *node);
 /* 红黑树信息的打印 */
 Status PrintRBTreeInfo(RBTree tree, RBTreeElemType data, int position);
 
+/* 红黑树统计信息的打印 */
+Status PrintRBTreeStats(RBRoot *root);
+
 /* 凹入法打印红黑树 */
 Status recessedPrintRBTree(RBTree tree, int depth);
 
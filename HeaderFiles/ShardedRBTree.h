@@ -0,0 +1,68 @@
+/**
+ * @filename ShardedRBTree.h
+ * @description Key-range sharded Red-Black tree interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef SHARDEDRBTREE_H
+#define SHARDEDRBTREE_H
+
+#if RBTREE_SHARDED
+
+#include <pthread.h>
+
+#define RBTREE_SHARD_CHECK_INTERVAL 1024 /* 分片每插入该数量的结点检查一次是否倾斜 */
+#define RBTREE_SHARD_SKEW           4    /* 分片结点数超过(最小分片的结点数 + 检查间隔)的该倍数时重新划分边界 */
+
+/* 一个分片: 独立的红黑树、锁和结点池, 负责[lo, 下一分片的lo)内的键; 按缓存行对齐, 避免相邻分片的锁伪共享 */
+typedef struct RBTreeShard {
+    pthread_mutex_t lock;      /* 分片锁 */
+    RBRoot *root;              /* 分片的红黑树, 使用独立的结点池 */
+    RBTreeElemType lo;         /* 分片的最小键(含), 第0个分片没有下界 */
+    int count;                 /* 分片的结点数 */
+    int inserts;               /* 距上次倾斜检查的插入数 */
+} RBTreeCacheAligned RBTreeShard;
+
+/* 按键范围分片的红黑树 */
+typedef struct ShardedRBTree {
+    int shardCount;            /* 分片数 */
+    RBTreeShard *shards;       /* 按键范围递增排列的分片, 由RBTreeAlignedCalloc分配 */
+    pthread_mutex_t rebalanceLock; /* 串行化边界调整 */
+} ShardedRBTree;
+
+/* 创建分片红黑树 */
+ShardedRBTree *createShardedRBTree(int shardCount, RBTreeElemType lo, RBTreeElemType hi);
+
+/* 销毁分片红黑树 */
+Status destroyShardedRBTree(ShardedRBTree *tree);
+
+/* 分片红黑树插入结点 */
+Status insertShardedRBTree(ShardedRBTree *tree, RBTreeElemType x);
+
+/* 分片红黑树删除结点 */
+Status deleteShardedRBTree(ShardedRBTree *tree, RBTreeElemType x);
+
+/* 分片红黑树查找结点 */
+Status searchShardedRBTree(ShardedRBTree *tree, RBTreeElemType x);
+
+/* 分片红黑树的最小值 */
+Status minShardedRBTree(ShardedRBTree *tree, RBTreeElemType *minVal);
+
+/* 分片红黑树的最大值 */
+Status maxShardedRBTree(ShardedRBTree *tree, RBTreeElemType *maxVal);
+
+/* 分片红黑树的结点数 */
+int sizeShardedRBTree(ShardedRBTree *tree);
+
+/* 按键的全局顺序遍历分片红黑树 */
+Status visitShardedRBTree(ShardedRBTree *tree, RBTreeVisitFunc visit, void *arg);
+
+/* 按当前键分布重新划分分片边界 */
+Status rebalanceShardedRBTree(ShardedRBTree *tree);
+
+#endif /* RBTREE_SHARDED */
+
+#endif /* SHARDEDRBTREE_H */
@@ -0,0 +1,60 @@
+/**
+ * @filename TopDownRBTree.h
+ * @description Parent-pointer-free top-down Red-Black tree interface declaration
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include "RedBlackTree.h"
+
+#ifndef TOPDOWNRBTREE_H
+#define TOPDOWNRBTREE_H
+
+#define RBTREE_TOPDOWN_MAX_HEIGHT 64 /* 结点数不超过INT_MAX时树高不超过62, 迭代器的栈深度 */
+
+#define TopDownRBTreeIteratorData(it) ((it)->stack[(it)->top - 1]->data)
+
+/* 没有父结点指针的结点, 64位下24字节 */
+typedef struct TopDownNode {
+    RBTreeElemType data;         /* 数据域 */
+    char color;                  /* 颜色 */
+    struct TopDownNode *link[2]; /* link[0]为左孩子结点, link[1]为右孩子结点 */
+} TopDownNode;
+
+/* 自顶向下单趟插入和删除的红黑树 */
+typedef struct TopDownRBTree {
+    TopDownNode *root; /* 根结点 */
+    int count;         /* 结点数 */
+} TopDownRBTree;
+
+/* 中序迭代器, 栈中依次为当前结点及其尚未访问的祖先, top为0表示迭代器越界 */
+typedef struct TopDownRBTreeIterator {
+    TopDownNode *stack[RBTREE_TOPDOWN_MAX_HEIGHT];
+    int top;
+} TopDownRBTreeIterator;
+
+/* 创建自顶向下的红黑树 */
+TopDownRBTree *createTopDownRBTree();
+
+/* 销毁自顶向下的红黑树 */
+Status destroyTopDownRBTree(TopDownRBTree *tree);
+
+/* 查找键 */
+Status searchTopDownRBTree(TopDownRBTree *tree, RBTreeElemType x);
+
+/* 插入结点 */
+Status insertTopDownRBTree(TopDownRBTree *tree, RBTreeElemType x);
+
+/* 删除结点 */
+Status deleteTopDownRBTree(TopDownRBTree *tree, RBTreeElemType x);
+
+/* 迭代器定位到最小结点 */
+Status firstTopDownRBTreeIterator(TopDownRBTreeIterator *it, TopDownRBTree *tree);
+
+/* 迭代器定位到第一个不小于x的结点 */
+Status seekTopDownRBTreeIterator(TopDownRBTreeIterator *it, TopDownRBTree *tree, RBTreeElemType x);
+
+/* 迭代器移动到后继结点 */
+Status nextTopDownRBTreeIterator(TopDownRBTreeIterator *it);
+
+#endif /* TOPDOWNRBTREE_H */
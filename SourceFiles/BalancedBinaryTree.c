@@ -6,6 +6,7 @@
  */
 
 #include "../HeaderFiles/BalancedBinaryTree.h"
+#include "../HeaderFiles/RedBlackTreeUtils.h"
 
 /**
  * 将平衡二叉树的结点node左旋
@@ -24,20 +25,25 @@
 Status RBTreeLeftRotate(RBRoot *root, Node *node)
 {
     Node *p = node->right;
-    node->right = p->left;
+    RBTreeStoreLink(node->right, p->left);
 
-    if (p->left) p->left->parent = node;
+    if (p->left) RBTreeSetParent(p->left, node);
 
-    p->parent = node->parent;
+    RBTreeSetParent(p, RBTreeParent(node));
 
-    if (!node->parent) root->node = p;
+    if (!RBTreeParent(node)) RBTreeStoreLink(root->node, p);
     else {
-        if (node->parent->left == node) node->parent->left = p;
-        else node->parent->right = p;
+        if (RBTreeParent(node)->left == node) RBTreeStoreLink(RBTreeParent(node)->left, p);
+        else RBTreeStoreLink(RBTreeParent(node)->right, p);
     }
 
-    p->left = node;
-    node->parent = p;
+    RBTreeStoreLink(p->left, node);
+    RBTreeSetParent(node, p);
+
+    /* 旋转后node成为p的孩子, 先更新node再更新p */
+    RBTreeAugmentNode(node);
+    RBTreeAugmentNode(p);
+    RBTreeCount(root, rotations, 1);
 
     return SUCCESS;
 }
@@ -59,20 +65,25 @@ Status RBTreeLeftRotate(RBRoot *root, Node *node)
 Status RBTreeRightRotate(RBRoot *root, Node *node)
 {
     Node *p = node->left;
-    node->left = p->right;
+    RBTreeStoreLink(node->left, p->right);
 
-    if (p->right) p->right->parent = node;
+    if (p->right) RBTreeSetParent(p->right, node);
 
-    p->parent = node->parent;
+    RBTreeSetParent(p, RBTreeParent(node));
 
-    if (!node->parent) root->node = p;
+    if (!RBTreeParent(node)) RBTreeStoreLink(root->node, p);
     else {
-        if (node == node->parent->right) node->parent->right = p;
-        else node->parent->left = p;
+        if (node == RBTreeParent(node)->right) RBTreeStoreLink(RBTreeParent(node)->right, p);
+        else RBTreeStoreLink(RBTreeParent(node)->left, p);
     }
 
-    p->right = node;
-    node->parent = p;
+    RBTreeStoreLink(p->right, node);
+    RBTreeSetParent(node, p);
+
+    /* 旋转后node成为p的孩子, 先更新node再更新p */
+    RBTreeAugmentNode(node);
+    RBTreeAugmentNode(p);
+    RBTreeCount(root, rotations, 1);
 
     return SUCCESS;
 }
@@ -7,6 +7,7 @@
 
 #include <stdio.h>
 #include "../HeaderFiles/BinarySearchTree.h"
+#include "../HeaderFiles/RedBlackTreeUtils.h"
 
 /**
  * 二叉查找树插入结点
@@ -19,24 +20,118 @@ Status insertBinarySearchTree(RBRoot *root, Node *node)
 {
     Node *p = root->node;
     Node *last = NULL;
+#if RBTREE_STATS
+    unsigned long long visited = 0;
+#endif
 
     while (p) {
         last = p;
+#if RBTREE_STATS
+        visited++;
+#endif
         if (node->data < p->data) p = p->left;
         else p = p->right;
     }
-    RBTreeParent(node) = last;
+    RBTreeCount(root, searches, 1);
+    RBTreeCount(root, comparisons, visited);
+    RBTreeSetParent(node, last);
 
     if (last) {
-        if (node->data < last->data) last->left = node;
-        else last->right = node;
-    } else root->node = node;
+        if (node->data < last->data) RBTreeStoreLink(last->left, node);
+        else RBTreeStoreLink(last->right, node);
+    } else RBTreeStoreLink(root->node, node);
+    if (!root->rightmost || node->data > root->rightmost->data) root->rightmost = node;
 
-    node->color = RED;
+    RBTreeSetColor(node, RED);
+    RBTreeAugmentPath(node);
 
     return SUCCESS;
 }
 
+/**
+ * 二叉查找树单次下降查找数据域为x的结点, 不存在时给出插入位置
+ *
+ * @param[in]  root  : the tree whose counters record the descent
+ * @param[in]  tree  : the subtree to descend from
+ * @param[in]  x     : the data of the node
+ * @param[out] parent: the parent of the insert position if x is not found
+ * @return  the node whose data is x, NULL if not found
+ */
+RBTree searchInsertPosition(RBRoot *root, RBTree tree, RBTreeElemType x, Node **parent)
+{
+    Node *last = NULL;
+#if RBTREE_STATS
+    unsigned long long visited = 0;
+#else
+    (void) root;
+#endif
+
+    while (tree) {
+#if RBTREE_STATS
+        visited++;
+#endif
+        if (x < tree->data) {
+            last = tree;
+            tree = tree->left;
+        } else if (x > tree->data) {
+            last = tree;
+            tree = tree->right;
+        } else break;
+    }
+    RBTreeCountShared(root, searches, 1);
+    RBTreeCountShared(root, comparisons, visited);
+    if (tree) return tree;
+    *parent = last;
+
+    return NULL;
+}
+
+/**
+ * 二叉查找树将结点链接到searchInsertPosition给出的插入位置
+ *
+ * @param[in]  root  : the root of the binary search tree
+ * @param[in]  node  : the inserted node
+ * @param[in]  parent: the parent of the insert position
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status linkBinarySearchTree(RBRoot *root, Node *node, Node *parent)
+{
+    RBTreeSetParent(node, parent);
+
+    if (parent) {
+        if (node->data < parent->data) RBTreeStoreLink(parent->left, node);
+        else RBTreeStoreLink(parent->right, node);
+    } else RBTreeStoreLink(root->node, node);
+    if (!root->rightmost || node->data > root->rightmost->data) root->rightmost = node;
+
+    RBTreeSetColor(node, RED);
+    RBTreeAugmentPath(node);
+
+    return SUCCESS;
+}
+
+/**
+ * 二叉查找树从指针结点向上回溯到子树键范围包含x的最近祖先, 从该祖先下降即可找到x或其插入位置.
+ * x与指针结点越接近, 回溯和下降的层数越少
+ *
+ * @param[in]  finger: the node near x
+ * @param[in]  x     : the data to search for
+ * @return  the root of the subtree to search x in
+ */
+RBTree BSTreeFingerAncestor(RBTree finger, RBTreeElemType x)
+{
+    Node *parent;
+
+    /* 父结点与指针结点位于x的同一侧时, x不在当前子树的键范围内 */
+    if (x >= finger->data) {
+        while ((parent = RBTreeParent(finger)) && parent->data <= x) finger = parent;
+    } else {
+        while ((parent = RBTreeParent(finger)) && parent->data >= x) finger = parent;
+    }
+
+    return finger;
+}
+
 /**
  * 二叉查找树查找最小结点
  *
@@ -67,6 +162,50 @@ RBTree maxBinarySearchTreeNode(RBTree tree)
     return tree;
 }
 
+/**
+ * 二叉查找树查找第一个数据域不小于x的结点
+ *
+ * @param[in]  tree: the root of the binary search tree
+ * @param[in]  x   : the lower bound
+ * @return  the target node, NULL if all nodes are less than x
+ */
+RBTree BSTreeLowerBound(RBTree tree, RBTreeElemType x)
+{
+    Node *result = NULL;
+
+    while (tree) {
+        if (tree->data < x) tree = tree->right;
+        else {
+            result = tree;
+            tree = tree->left;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * 二叉查找树查找第一个数据域大于x的结点
+ *
+ * @param[in]  tree: the root of the binary search tree
+ * @param[in]  x   : the upper bound
+ * @return  the target node, NULL if no node is greater than x
+ */
+RBTree BSTreeUpperBound(RBTree tree, RBTreeElemType x)
+{
+    Node *result = NULL;
+
+    while (tree) {
+        if (tree->data <= x) tree = tree->right;
+        else {
+            result = tree;
+            tree = tree->left;
+        }
+    }
+
+    return result;
+}
+
 /**
  * 二叉查找树查找结点node的前驱结点
  *
@@ -77,10 +216,10 @@ RBTree BSTreePrecursor(RBTree node)
 {
     if (node->left) return maxBinarySearchTreeNode(node->left);
 
-    Node *p = node->parent;
+    Node *p = RBTreeParent(node);
     while (p && (node == p->left)) {
         node = p;
-        p = p->parent;
+        p = RBTreeParent(p);
     }
 
     return p;
@@ -96,10 +235,10 @@ RBTree BSTreeSuccessor(RBTree node)
 {
     if (node->right) return minBinarySearchTreeNode(node->right);
 
-    Node *p = node->parent;
+    Node *p = RBTreeParent(node);
     while (p && (node == p->right)) {
         node = p;
-        p = p->parent;
+        p = RBTreeParent(p);
     }
 
     return p;
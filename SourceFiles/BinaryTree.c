@@ -9,8 +9,93 @@
 #include <stdlib.h>
 #include "../HeaderFiles/BinaryTree.h"
 
+/* 打印结点数据的遍历回调 */
+static int printVisit(Node *node, void *arg)
+{
+    (void) arg;
+    printf("%d ", node->data);
+
+    return 0;
+}
+
+/**
+ * 沿父结点指针中序遍历子树, 不使用递归和栈. 有右子树时下降到其最小结点,
+ * 否则回溯到第一个从左子树返回的祖先, 不像通用的遍历那样在每个结点判断来向
+ *
+ * @param[in]  tree : the node of the binary tree
+ * @param[in]  visit: the callback applied to each node, non-zero stops the traversal
+ * @param[in]  arg  : the argument passed to visit
+ * @return  SUCCESS if all nodes are visited, FAILED if stopped by visit
+ */
+static Status inorderVisit(RBTree tree, RBTreeVisitFunc visit, void *arg)
+{
+    Node *stop = RBTreeParent(tree);
+    Node *p = tree, *child;
+
+    while (p->left) p = p->left;
+    for (;;) {
+        if (visit(p, arg)) return FAILED;
+        if (p->right) {
+            p = p->right;
+            while (p->left) p = p->left;
+            continue;
+        }
+        do {
+            child = p;
+            p = RBTreeParent(p);
+        } while (p != stop && child == p->right);
+        if (p == stop) return SUCCESS;
+    }
+}
+
+/**
+ * 以回调方式遍历二叉树, 沿父结点指针移动, 不使用递归和栈, 后序访问中可以释放结点
+ *
+ * @param[in]  tree : the node of the binary tree
+ * @param[in]  order: RBTREE_PREORDER, RBTREE_INORDER or RBTREE_POSTORDER
+ * @param[in]  visit: the callback applied to each node, non-zero stops the traversal
+ * @param[in]  arg  : the argument passed to visit
+ * @return  SUCCESS if all nodes are visited, FAILED if empty or stopped by visit
+ */
+Status visitBiTree(RBTree tree, RBTreeOrder order, RBTreeVisitFunc visit, void *arg)
+{
+    if (!tree) return FAILED;
+    if (order == RBTREE_INORDER) return inorderVisit(tree, visit, arg);
+
+    Node *stop = RBTreeParent(tree);
+    Node *prev = stop, *p = tree;
+
+    while (p != stop) {
+        if (prev == RBTreeParent(p)) {  /* 从父结点下降而来 */
+            if (order == RBTREE_PREORDER && visit(p, arg)) return FAILED;
+            prev = p;
+            if (p->left) {
+                p = p->left;
+                continue;
+            }
+            if (p->right) {
+                p = p->right;
+                continue;
+            }
+        } else if (prev == p->left) {  /* 从左子树返回 */
+            prev = p;
+            if (p->right) {
+                p = p->right;
+                continue;
+            }
+        } else prev = p;  /* 从右子树返回 */
+
+        /* 后序访问可能释放结点, 先取出父结点 */
+        Node *parent = RBTreeParent(p);
+        if (order == RBTREE_POSTORDER && visit(p, arg)) return FAILED;
+        p = parent;
+    }
+
+    return SUCCESS;
+}
+
 /**
- * 销毁二叉树
+ * 销毁二叉树, 通过旋转拉直后逐个释放, 只使用常数额外空间
  *
  * @param[in]  tree  the node of the binary tree
  * @return  the operation status, SUCCESS is 0, FAILED is -1
@@ -19,10 +104,19 @@ Status destroyBinaryTree(RBTree tree)
 {
     if (!tree) return FAILED;
 
-    if (tree->left) destroyBinaryTree(tree->left);
-    if (tree->right) destroyBinaryTree(tree->right);
+    Node *p = tree, *next;
 
-    free(tree);
+    while (p) {
+        if (p->left) {  /* 右旋摘下左孩子, 把树逐步拉直成右链 */
+            next = p->left;
+            p->left = next->right;
+            next->right = p;
+        } else {
+            next = p->right;
+            free(p);
+        }
+        p = next;
+    }
 
     return SUCCESS;
 }
@@ -35,14 +129,7 @@ Status destroyBinaryTree(RBTree tree)
  */
 Status preorderBiTree(RBTree tree)
 {
-    if (!tree) return FAILED;
-    else {
-        printf("%d ", tree->data);
-        preorderBiTree(tree->left);
-        preorderBiTree(tree->right);
-    }
-
-    return SUCCESS;
+    return visitBiTree(tree, RBTREE_PREORDER, printVisit, NULL);
 }
 
 /**
@@ -53,14 +140,7 @@ Status preorderBiTree(RBTree tree)
  */
 Status inorderBiTree(RBTree tree)
 {
-    if (!tree) return FAILED;
-    else {
-        inorderBiTree(tree->left);
-        printf("%d ", tree->data);
-        inorderBiTree(tree->right);
-    }
-
-    return SUCCESS;
+    return visitBiTree(tree, RBTREE_INORDER, printVisit, NULL);
 }
 
 /**
@@ -71,26 +151,22 @@ Status inorderBiTree(RBTree tree)
  */
 Status postorderBiTree(RBTree tree)
 {
-    if (!tree) return FAILED;
-    else {
-        postorderBiTree(tree->left);
-        postorderBiTree(tree->right);
-        printf("%d ", tree->data);
-    }
-
-    return SUCCESS;
+    return visitBiTree(tree, RBTREE_POSTORDER, printVisit, NULL);
 }
 
 /**
- * 递归查找二叉树tree中数据域为x的结点
+ * 查找二叉树tree中数据域为x的结点, 循环实现
  *
  * @param[in]  tree: the node of the binary tree
  * @param[in]  x   : the data of the node
  * @return  the target node
  */
-RBTree recursiveSearchNode(RBTree tree, RBTreeElemType x)
+RBTree searchBiTreeNode(RBTree tree, RBTreeElemType x)
 {
-    if (!tree || tree->data == x) return tree;
-    else if (tree->data > x) return recursiveSearchNode(tree->left, x);
-    else return recursiveSearchNode(tree->right, x);
+    while (tree && tree->data != x) {
+        if (tree->data > x) tree = tree->left;
+        else tree = tree->right;
+    }
+
+    return tree;
 }
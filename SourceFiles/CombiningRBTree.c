@@ -0,0 +1,208 @@
+/**
+ * @filename CombiningRBTree.c
+ * @description Flat-combining concurrent Red-Black tree interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 每个线程把操作写入自己的槽位, 然后尝试获取合并者锁. 获得锁的线程成为合并者,
+ * 收集所有槽位中已发布的操作, 按键排序后从上一个键附近的结点出发依次执行,
+ * 写回结果并清空槽位; 其余线程只需等待自己的槽位被清空.
+ * 锁在一趟合并中只交接一次, 而互斥锁每个操作都要在线程间交接,
+ * 树的缓存行也始终留在合并者的缓存中.
+ */
+
+#include <sched.h>
+#include "../HeaderFiles/CombiningRBTree.h"
+#include "../HeaderFiles/RedBlackTreeUtils.h"
+#include "../HeaderFiles/BinarySearchTree.h"
+
+#if RBTREE_COMBINING
+
+/**
+ * 合并者执行一趟: 收集已发布的操作, 按键排序后依次执行
+ *
+ * @param[in]  tree: the flat-combining red-black tree, the combiner lock is held
+ * @return  none
+ */
+static void combine(CombiningRBTree *tree)
+{
+    int count = __atomic_load_n(&tree->threadCount, __ATOMIC_ACQUIRE);
+    int n = 0, inserted, i, j;
+    Node *finger = NULL, *node;
+
+    if (count > RBTREE_COMBINING_MAX_THREADS) count = RBTREE_COMBINING_MAX_THREADS;
+    for (i = 0; i < count; i++) {
+        if (__atomic_load_n(&tree->slots[i].op, __ATOMIC_ACQUIRE) != RBTREE_COMBINING_IDLE) tree->pending[n++] = i;
+    }
+
+    /* 至多RBTREE_COMBINING_MAX_THREADS个操作, 插入排序即可 */
+    for (i = 1; i < n; i++) {
+        int slot = tree->pending[i];
+        RBTreeElemType key = tree->slots[slot].key;
+
+        for (j = i; j > 0 && tree->slots[tree->pending[j - 1]].key > key; j--) tree->pending[j] = tree->pending[j - 1];
+        tree->pending[j] = slot;
+    }
+
+    for (i = 0; i < n; i++) {
+        RBTreeCombiningSlot *slot = &tree->slots[tree->pending[i]];
+        RBTreeElemType x = slot->key;
+        Status result = FAILED;
+
+        switch (slot->op) {
+            case RBTREE_COMBINING_INSERT:
+                node = insertHintRBTree(tree->root, finger, x, &inserted);
+                if (node) {
+                    result = inserted ? SUCCESS : FAILED;
+                    finger = node;
+                }
+                break;
+            case RBTREE_COMBINING_DELETE:
+                node = searchHintRBTree(tree->root, finger, x);
+                if (node) {
+                    /* 删除只重新链接结点, 前驱结点在删除后仍然有效 */
+                    finger = BSTreePrecursor(node);
+                    deleteRBTreeNode(tree->root, node);
+                    result = SUCCESS;
+                }
+                break;
+            default:
+                node = searchHintRBTree(tree->root, finger, x);
+                if (node) {
+                    finger = node;
+                    result = SUCCESS;
+                }
+                break;
+        }
+
+        slot->result = result;
+        __atomic_store_n(&slot->op, RBTREE_COMBINING_IDLE, __ATOMIC_RELEASE);
+    }
+
+    tree->passes++;
+    tree->combined += (unsigned long) n;
+}
+
+/**
+ * 发布操作并等待其完成, 期间能获得合并者锁时代为执行所有已发布的操作
+ *
+ * @param[in]  tree  : the flat-combining red-black tree
+ * @param[in]  thread: the thread id
+ * @param[in]  op    : the operation
+ * @param[in]  x     : the key
+ * @return  the result of the operation
+ */
+static Status execute(CombiningRBTree *tree, int thread, RBTreeCombiningOp op, RBTreeElemType x)
+{
+    RBTreeCombiningSlot *slot;
+
+    if (!tree || thread < 0 || thread >= RBTREE_COMBINING_MAX_THREADS) return FAILED;
+
+    slot = &tree->slots[thread];
+    slot->key = x;
+    __atomic_store_n(&slot->op, op, __ATOMIC_RELEASE);
+
+    for (;;) {
+        if (__atomic_load_n(&slot->op, __ATOMIC_ACQUIRE) == RBTREE_COMBINING_IDLE) return slot->result;
+        if (pthread_mutex_trylock(&tree->lock) == 0) {
+            combine(tree);
+            pthread_mutex_unlock(&tree->lock);
+        } else sched_yield();
+    }
+}
+
+/**
+ * 创建平面合并的并发红黑树
+ *
+ * @param[in]  allocator: the node allocator, NULL means malloc/free, released with the tree
+ * @return  the flat-combining red-black tree, NULL if out of memory
+ */
+CombiningRBTree *createCombiningRBTree(RBTreeAllocator *allocator)
+{
+    CombiningRBTree *tree = (CombiningRBTree *) RBTreeAlignedCalloc(sizeof(CombiningRBTree));
+    if (!tree) return NULL;
+
+    tree->root = createRBTree();
+    if (!tree->root) {
+        RBTreeAlignedFree(tree);
+        return NULL;
+    }
+    setRBTreeAllocator(tree->root, allocator);
+    pthread_mutex_init(&tree->lock, NULL);
+
+    return tree;
+}
+
+/**
+ * 销毁平面合并的并发红黑树, 调用时不能有线程正在访问
+ *
+ * @param[in]  tree: the flat-combining red-black tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status destroyCombiningRBTree(CombiningRBTree *tree)
+{
+    if (!tree) return FAILED;
+
+    destroyRBTree(tree->root);
+    pthread_mutex_destroy(&tree->lock);
+    RBTreeAlignedFree(tree);
+
+    return SUCCESS;
+}
+
+/**
+ * 注册线程, 每个线程注册一次, 之后以返回的编号执行操作
+ *
+ * @param[in]  tree: the flat-combining red-black tree
+ * @return  the thread id, -1 if there are too many threads
+ */
+int registerCombiningRBTreeThread(CombiningRBTree *tree)
+{
+    int thread;
+
+    if (!tree) return -1;
+    thread = __atomic_fetch_add(&tree->threadCount, 1, __ATOMIC_ACQ_REL);
+
+    return thread < RBTREE_COMBINING_MAX_THREADS ? thread : -1;
+}
+
+/**
+ * 平面合并的并发红黑树插入结点
+ *
+ * @param[in]  tree  : the flat-combining red-black tree
+ * @param[in]  thread: the thread id
+ * @param[in]  x     : the data to be inserted
+ * @return  the operation status, SUCCESS is 0, FAILED is -1 if x exists or out of memory
+ */
+Status insertCombiningRBTree(CombiningRBTree *tree, int thread, RBTreeElemType x)
+{
+    return execute(tree, thread, RBTREE_COMBINING_INSERT, x);
+}
+
+/**
+ * 平面合并的并发红黑树删除结点
+ *
+ * @param[in]  tree  : the flat-combining red-black tree
+ * @param[in]  thread: the thread id
+ * @param[in]  x     : the data to be deleted
+ * @return  the operation status, SUCCESS is 0, FAILED is -1 if x is not found
+ */
+Status deleteCombiningRBTree(CombiningRBTree *tree, int thread, RBTreeElemType x)
+{
+    return execute(tree, thread, RBTREE_COMBINING_DELETE, x);
+}
+
+/**
+ * 平面合并的并发红黑树查找结点, 与写操作一同合并执行
+ *
+ * @param[in]  tree  : the flat-combining red-black tree
+ * @param[in]  thread: the thread id
+ * @param[in]  x     : the data to be searched
+ * @return  SUCCESS if x is found, otherwise FAILED
+ */
+Status searchCombiningRBTree(CombiningRBTree *tree, int thread, RBTreeElemType x)
+{
+    return execute(tree, thread, RBTREE_COMBINING_SEARCH, x);
+}
+
+#endif /* RBTREE_COMBINING */
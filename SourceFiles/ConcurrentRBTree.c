@@ -0,0 +1,323 @@
+/**
+ * @filename ConcurrentRBTree.c
+ * @description Red-Black tree with a single writer and lock-free readers interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 写者之间由互斥锁串行化, 读者不加锁:
+ * 1. 写者修改孩子指针时以release语义发布(RBTreeStoreLink), 读者以acquire语义读取,
+ *    因此读者看到的结点总是已初始化完毕, 且结点的数据域在发布后不再修改.
+ * 2. 写者在修改前后各递增一次写序号. 读者找到x时结果一定有效(该结点在读期间某一时刻位于树中);
+ *    未找到时若写序号发生变化, 则可能是旋转中途漏掉了结点, 需要重试.
+ * 3. 被删除的结点不立即释放, 按删除时的纪元挂入待回收链表,
+ *    全局纪元前进两次后不再有读者持有它的指针, 此时才真正释放.
+ */
+
+#include <sched.h>
+#include <stdlib.h>
+#include "../HeaderFiles/ConcurrentRBTree.h"
+#include "../HeaderFiles/RedBlackTreeUtils.h"
+
+#if RBTREE_CONCURRENT_READERS
+
+static void waitGracePeriod(ConcurrentRBTree *tree);
+
+static Node *deferAllocNode(void *context)
+{
+    ConcurrentRBTree *tree = (ConcurrentRBTree *) context;
+
+    if (tree->backing) return tree->backing->allocNode(tree->backing->context);
+    return (Node *) malloc(sizeof(Node));
+}
+
+static size_t deferReservedBytes(void *context)
+{
+    ConcurrentRBTree *tree = (ConcurrentRBTree *) context;
+
+    return tree->backing->reservedBytes(tree->backing->context);
+}
+
+static void releaseNode(ConcurrentRBTree *tree, Node *node)
+{
+    if (tree->backing) tree->backing->freeNode(tree->backing->context, node);
+    else free(node);
+}
+
+/* 删除的结点挂入当前纪元的待回收链表, 不能借用结点的指针域, 读者可能仍在经过它 */
+static void deferFreeNode(void *context, Node *node)
+{
+    ConcurrentRBTree *tree = (ConcurrentRBTree *) context;
+    RBTreeRetireList *list = &tree->retired[tree->epoch % 3];
+
+    if (list->count == list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : RBTREE_RECLAIM_BATCH;
+        Node **nodes = (Node **) realloc(list->nodes, sizeof(Node *) * capacity);
+        if (!nodes) {
+            /* 无法延迟时等待宽限期结束后直接释放 */
+            waitGracePeriod(tree);
+            releaseNode(tree, node);
+            return;
+        }
+        list->nodes = nodes;
+        list->capacity = capacity;
+    }
+    list->nodes[list->count++] = node;
+    tree->pending++;
+}
+
+/**
+ * 释放待回收链表中的全部结点
+ *
+ * @param[in]  tree: the concurrent red-black tree
+ * @param[in]  list: the retire list
+ * @return  none
+ */
+static void reclaimRetireList(ConcurrentRBTree *tree, RBTreeRetireList *list)
+{
+    int i;
+
+    for (i = 0; i < list->count; i++) releaseNode(tree, list->nodes[i]);
+    tree->pending -= list->count;
+    list->count = 0;
+}
+
+/**
+ * 尝试推进全局纪元, 所有活跃读者都已进入当前纪元时才能推进,
+ * 推进后回收两个纪元之前删除的结点
+ *
+ * @param[in]  tree: the concurrent red-black tree
+ * @return  1 if the epoch advanced, otherwise 0
+ */
+static int advanceEpoch(ConcurrentRBTree *tree)
+{
+    unsigned long epoch = tree->epoch;
+    int count = __atomic_load_n(&tree->readerCount, __ATOMIC_ACQUIRE), i;
+
+    if (count > RBTREE_MAX_READERS) count = RBTREE_MAX_READERS;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    for (i = 0; i < count; i++) {
+        unsigned long slot = __atomic_load_n(&tree->readers[i].epoch, __ATOMIC_ACQUIRE);
+        if ((slot & 1) && (slot >> 1) != epoch) return 0;
+    }
+
+    __atomic_store_n(&tree->epoch, epoch + 1, __ATOMIC_RELEASE);
+    reclaimRetireList(tree, &tree->retired[(epoch + 2) % 3]);
+
+    return 1;
+}
+
+/* 写者开始修改, 写序号变为奇数 */
+static void beginWrite(ConcurrentRBTree *tree)
+{
+    __atomic_store_n(&tree->sequence, tree->sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+/* 写者结束修改, 写序号变为偶数, 并在待回收结点较多时尝试回收 */
+static void endWrite(ConcurrentRBTree *tree)
+{
+    __atomic_store_n(&tree->sequence, tree->sequence + 1, __ATOMIC_RELEASE);
+    if (tree->pending >= RBTREE_RECLAIM_BATCH) advanceEpoch(tree);
+}
+
+/**
+ * 创建并发红黑树
+ *
+ * @param[in]  allocator: the node allocator used by the writer, NULL means malloc/free
+ * @return  the concurrent red-black tree, NULL if out of memory
+ */
+ConcurrentRBTree *createConcurrentRBTree(RBTreeAllocator *allocator)
+{
+    ConcurrentRBTree *tree = (ConcurrentRBTree *) RBTreeAlignedCalloc(sizeof(ConcurrentRBTree));
+    if (!tree) return NULL;
+
+    tree->root = createRBTree();
+    if (!tree->root) {
+        RBTreeAlignedFree(tree);
+        return NULL;
+    }
+    tree->backing = allocator;
+    tree->allocator.allocNode = deferAllocNode;
+    tree->allocator.freeNode = deferFreeNode;
+    tree->allocator.releaseAll = NULL;
+    tree->allocator.reservedBytes = allocator && allocator->reservedBytes ? deferReservedBytes : NULL;
+    tree->allocator.context = tree;
+    setRBTreeAllocator(tree->root, &tree->allocator);
+    pthread_mutex_init(&tree->writeLock, NULL);
+
+    return tree;
+}
+
+/**
+ * 销毁并发红黑树, 调用时不能有读者或写者正在访问
+ *
+ * @param[in]  tree: the concurrent red-black tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status destroyConcurrentRBTree(ConcurrentRBTree *tree)
+{
+    int i;
+
+    if (!tree) return FAILED;
+
+    for (i = 0; i < 3; i++) {
+        reclaimRetireList(tree, &tree->retired[i]);
+        free(tree->retired[i].nodes);
+    }
+    /* 剩余结点交还实际的分配器统一释放 */
+    tree->root->allocator = tree->backing;
+    destroyRBTree(tree->root);
+    pthread_mutex_destroy(&tree->writeLock);
+    RBTreeAlignedFree(tree);
+
+    return SUCCESS;
+}
+
+/**
+ * 注册读者线程, 每个读者线程注册一次, 之后以返回的编号查找
+ *
+ * @param[in]  tree: the concurrent red-black tree
+ * @return  the reader id, -1 if there are too many readers
+ */
+int registerConcurrentRBTreeReader(ConcurrentRBTree *tree)
+{
+    int reader;
+
+    if (!tree) return -1;
+    reader = __atomic_fetch_add(&tree->readerCount, 1, __ATOMIC_ACQ_REL);
+
+    return reader < RBTREE_MAX_READERS ? reader : -1;
+}
+
+/**
+ * 无锁查找并发红黑树, 读者不会阻塞写者, 也不会被写者阻塞
+ *
+ * @param[in]  tree  : the concurrent red-black tree
+ * @param[in]  reader: the reader id
+ * @param[in]  x     : the data to be searched
+ * @return  SUCCESS if x is found, otherwise FAILED
+ */
+Status searchConcurrentRBTree(ConcurrentRBTree *tree, int reader, RBTreeElemType x)
+{
+    RBTreeReaderSlot *slot;
+    Status status = FAILED;
+    int retries = 0;
+
+    if (!tree || reader < 0 || reader >= RBTREE_MAX_READERS) return FAILED;
+    slot = &tree->readers[reader];
+
+    /* 进入读临界区: 公布所处纪元, 之后读到的结点在退出前不会被释放 */
+    __atomic_store_n(&slot->epoch, (__atomic_load_n(&tree->epoch, __ATOMIC_ACQUIRE) << 1) | 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    for (;;) {
+        unsigned long sequence = __atomic_load_n(&tree->sequence, __ATOMIC_ACQUIRE);
+        Node *node = RBTreeLoadLink(tree->root->node);
+        int depth = 0;
+
+        while (node && depth++ < RBTREE_MAX_DEPTH) {
+            /* 两个孩子指针与数据域并行读取, 再无分支地选择 */
+            Node *left = RBTreeLoadLink(node->left), *right = RBTreeLoadLink(node->right);
+            if (x == node->data) break;
+            node = x < node->data ? left : right;
+        }
+        if (node && depth <= RBTREE_MAX_DEPTH) {
+            status = SUCCESS;
+            break;
+        }
+
+        /* 未找到: 期间没有写者修改过树时结果才可信 */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (!node && !(sequence & 1) && __atomic_load_n(&tree->sequence, __ATOMIC_RELAXED) == sequence) break;
+        /* 写者可能在修改中途被调度出去, 多次重试失败后让出处理器 */
+        if (++retries % RBTREE_READ_RETRIES == 0) sched_yield();
+    }
+
+    __atomic_store_n(&slot->epoch, 0, __ATOMIC_RELEASE);
+
+    return status;
+}
+
+/**
+ * 并发红黑树插入结点
+ *
+ * @param[in]  tree: the concurrent red-black tree
+ * @param[in]  x   : the data to be inserted
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status insertConcurrentRBTree(ConcurrentRBTree *tree, RBTreeElemType x)
+{
+    int inserted = 0;
+
+    if (!tree) return FAILED;
+
+    pthread_mutex_lock(&tree->writeLock);
+    /* 单次下降查找或插入; x已存在时写序号仍会变化, 只会让同时未命中的读者多重试一次 */
+    beginWrite(tree);
+    insertOrFindRBTree(tree->root, x, &inserted);
+    endWrite(tree);
+    pthread_mutex_unlock(&tree->writeLock);
+
+    return inserted ? SUCCESS : FAILED;
+}
+
+/**
+ * 并发红黑树删除结点, 结点在宽限期结束后才被释放
+ *
+ * @param[in]  tree: the concurrent red-black tree
+ * @param[in]  x   : the data to be deleted
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status deleteConcurrentRBTree(ConcurrentRBTree *tree, RBTreeElemType x)
+{
+    Node *node;
+    Status status = FAILED;
+
+    if (!tree) return FAILED;
+
+    pthread_mutex_lock(&tree->writeLock);
+    if ((node = searchRBTreeNode(tree->root, x)) != NULL) {
+        beginWrite(tree);
+        status = deleteRBTreeNode(tree->root, node);
+        endWrite(tree);
+    }
+    pthread_mutex_unlock(&tree->writeLock);
+
+    return status;
+}
+
+/**
+ * 等待当前所有读者退出读临界区, 并回收全部已删除的结点
+ *
+ * @param[in]  tree: the concurrent red-black tree
+ * @return  none
+ */
+static void waitGracePeriod(ConcurrentRBTree *tree)
+{
+    int advanced = 0;
+
+    /* 当前纪元和上一纪元删除的结点分别在推进一次和两次后回收 */
+    while (advanced < 2) {
+        if (advanceEpoch(tree)) advanced++;
+        else sched_yield();
+    }
+}
+
+/**
+ * 等待宽限期结束并回收全部已删除的结点, 读者线程不能调用
+ *
+ * @param[in]  tree: the concurrent red-black tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status synchronizeConcurrentRBTree(ConcurrentRBTree *tree)
+{
+    if (!tree) return FAILED;
+
+    pthread_mutex_lock(&tree->writeLock);
+    waitGracePeriod(tree);
+    pthread_mutex_unlock(&tree->writeLock);
+
+    return SUCCESS;
+}
+
+#endif /* RBTREE_CONCURRENT_READERS */
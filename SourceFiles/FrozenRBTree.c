@@ -0,0 +1,217 @@
+/**
+ * @filename FrozenRBTree.c
+ * @description Frozen read-only Red-Black tree in implicit Eytzinger layout interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * Eytzinger布局按层序存放完全二叉查找树, 查找时不需要孩子指针: 从k走到2k或2k + 1.
+ * 下降过程没有分支, 比较结果直接算出下一个下标; 结点k往下4层的16个后代
+ * keys[16k, 16k + 16)恰好占一个缓存行, 提前预取后访存延迟与比较重叠.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "../HeaderFiles/FrozenRBTree.h"
+#include "../HeaderFiles/BinarySearchTree.h"
+
+/* 下标k二进制末尾连续的1的个数 */
+#if defined(__GNUC__) || defined(__clang__)
+#define trailingOnes(k) __builtin_ctzll(~(unsigned long long) (k))
+#else
+static int trailingOnes(size_t k)
+{
+    int n = 0;
+
+    while (k & 1) {
+        k >>= 1;
+        n++;
+    }
+
+    return n;
+}
+#endif
+
+/**
+ * 按中序为Eytzinger数组的第k个位置及其子树依次填入红黑树的键
+ *
+ * @param[in]  keys  : the Eytzinger array
+ * @param[in]  n     : the number of keys
+ * @param[in]  k     : the position of the subtree root
+ * @param[in]  cursor: the next node of the red-black tree in order, advanced
+ */
+static void fillEytzinger(RBTreeElemType *keys, size_t n, size_t k, Node **cursor)
+{
+    if (k > n) return;
+
+    fillEytzinger(keys, n, 2 * k, cursor);
+    keys[k] = (*cursor)->data;
+    *cursor = BSTreeSuccessor(*cursor);
+    fillEytzinger(keys, n, 2 * k + 1, cursor);
+}
+
+/* 按中序读出Eytzinger数组, 得到递增的键 */
+static size_t readEytzinger(const RBTreeElemType *keys, size_t n, size_t k, RBTreeElemType *sorted, size_t i)
+{
+    if (k > n) return i;
+
+    i = readEytzinger(keys, n, 2 * k, sorted, i);
+    sorted[i++] = keys[k];
+
+    return readEytzinger(keys, n, 2 * k + 1, sorted, i);
+}
+
+/**
+ * 无分支地查找第一个不小于x的键
+ *
+ * @param[in]  frozen: the frozen tree
+ * @param[in]  x     : the lower bound
+ * @return  the position of the key, 0 if all keys are less than x
+ */
+static size_t lowerBoundIndex(const FrozenRBTree *frozen, RBTreeElemType x)
+{
+    const RBTreeElemType *keys = frozen->keys;
+    size_t n = (size_t) frozen->size, k = 1;
+
+    while (k <= n) {
+        /* 最后4层的第4代后代已越过数组末尾, 越界的指针运算是未定义行为, 此时不再预取 */
+        if (16 * k <= n) RBTreePrefetch(keys + 16 * k);
+        k = 2 * k + (keys[k] < x);
+    }
+
+    /* 去掉最后一次向左之后的全部向右步, 回到最后一个不小于x的结点 */
+    return k >> (trailingOnes(k) + 1);
+}
+
+/**
+ * 将红黑树冻结为只读的隐式布局, 原红黑树不变, 可以随后销毁
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @return  the frozen tree, NULL if out of memory or in interval mode
+ */
+FrozenRBTree *freezeRBTree(RBRoot *root)
+{
+    FrozenRBTree *frozen;
+    Node *cursor;
+    size_t n = 0;
+
+    /* 冻结的数组只存放左端点, 区间树不能冻结 */
+    if (RBTREE_INTERVAL || !root) return NULL;
+    for (cursor = minBinarySearchTreeNode(root->node); cursor; cursor = BSTreeSuccessor(cursor)) n++;
+
+    frozen = (FrozenRBTree *) malloc(sizeof(FrozenRBTree));
+    if (!frozen) return NULL;
+    frozen->memory = malloc(sizeof(RBTreeElemType) * (n + 1) + RBTREE_FROZEN_ALIGN);
+#if RBTREE_MULTISET
+    frozen->counts = (int *) malloc(sizeof(int) * (n + 1));
+    if (!frozen->counts || !frozen->memory) {
+        free(frozen->counts);
+        free(frozen->memory);
+        free(frozen);
+        return NULL;
+    }
+#else
+    if (!frozen->memory) {
+        free(frozen);
+        return NULL;
+    }
+#endif
+    frozen->keys = (RBTreeElemType *) (((uintptr_t) frozen->memory + RBTREE_FROZEN_ALIGN - 1)
+                                       & ~(uintptr_t) (RBTREE_FROZEN_ALIGN - 1));
+    frozen->size = (int) n;
+
+    cursor = minBinarySearchTreeNode(root->node);
+    fillEytzinger(frozen->keys, n, 1, &cursor);
+#if RBTREE_MULTISET
+    for (n = 0, cursor = minBinarySearchTreeNode(root->node); cursor; cursor = BSTreeSuccessor(cursor))
+        frozen->counts[n++] = cursor->count;
+#endif
+
+    return frozen;
+}
+
+/**
+ * 将冻结的红黑树解冻到空的红黑树中, 线性时间构建, 多重集合模式下恢复各键的个数
+ *
+ * @param[in]  frozen: the frozen tree
+ * @param[in]  root  : the empty red-black tree to build
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status thawFrozenRBTree(FrozenRBTree *frozen, RBRoot *root)
+{
+    RBTreeElemType *sorted;
+    Status status;
+
+    if (!frozen || !root || root->node) return FAILED;
+    if (frozen->size == 0) return SUCCESS;
+
+    sorted = (RBTreeElemType *) malloc(sizeof(RBTreeElemType) * frozen->size);
+    if (!sorted) return FAILED;
+
+    readEytzinger(frozen->keys, (size_t) frozen->size, 1, sorted, 0);
+#if RBTREE_MULTISET
+    status = buildRBTreeFromCounts(root, sorted, frozen->counts, frozen->size);
+#else
+    status = buildRBTreeFromCounts(root, sorted, NULL, frozen->size);
+#endif
+    free(sorted);
+
+    return status;
+}
+
+/**
+ * 销毁冻结的红黑树
+ *
+ * @param[in]  frozen: the frozen tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status destroyFrozenRBTree(FrozenRBTree *frozen)
+{
+    if (!frozen) return FAILED;
+
+    free(frozen->memory);
+#if RBTREE_MULTISET
+    free(frozen->counts);
+#endif
+    free(frozen);
+
+    return SUCCESS;
+}
+
+/**
+ * 冻结的红黑树查找键x
+ *
+ * @param[in]  frozen: the frozen tree
+ * @param[in]  x     : the key
+ * @return  SUCCESS if found, FAILED otherwise
+ */
+Status searchFrozenRBTree(FrozenRBTree *frozen, RBTreeElemType x)
+{
+    size_t k;
+
+    if (!frozen) return FAILED;
+
+    k = lowerBoundIndex(frozen, x);
+
+    return k && frozen->keys[k] == x ? SUCCESS : FAILED;
+}
+
+/**
+ * 冻结的红黑树查找第一个不小于x的键
+ *
+ * @param[in]  frozen: the frozen tree
+ * @param[in]  x     : the lower bound
+ * @param[out] result: the key found
+ * @return  SUCCESS if found, FAILED if all keys are less than x
+ */
+Status lowerBoundFrozenRBTree(FrozenRBTree *frozen, RBTreeElemType x, RBTreeElemType *result)
+{
+    size_t k;
+
+    if (!frozen) return FAILED;
+
+    k = lowerBoundIndex(frozen, x);
+    if (!k) return FAILED;
+    if (result) *result = frozen->keys[k];
+
+    return SUCCESS;
+}
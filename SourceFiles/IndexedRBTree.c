@@ -0,0 +1,378 @@
+/**
+ * @filename IndexedRBTree.c
+ * @description Red-Black tree with 32-bit index links interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include <stdlib.h>
+#include "../HeaderFiles/IndexedRBTree.h"
+
+#define IdxNode(t, i) ((t)->nodes[i])
+#define IdxParent(t, i) (IdxNode(t, i).parentColor >> 1)
+#define IdxColor(t, i) (IdxNode(t, i).parentColor & 1)
+#define IdxSetParent(t, i, p) do {IdxNode(t, i).parentColor = ((p) << 1) | IdxColor(t, i);} while(0)
+#define IdxSetColor(t, i, c) do {IdxNode(t, i).parentColor = (IdxNode(t, i).parentColor & ~1u) | (c);} while(0)
+
+#define INDEXED_MAX_CAPACITY 0x7FFFFFFFu /* 父结点下标占31位 */
+
+/**
+ * 创建下标链接的红黑树
+ *
+ * @param[in]  capacity: the initial number of node slots
+ * @return  the tree, NULL if out of memory
+ */
+IndexedRBTree *createIndexedRBTree(int capacity)
+{
+    IndexedRBTree *tree = (IndexedRBTree *) malloc(sizeof(IndexedRBTree));
+    if (!tree) return NULL;
+
+    tree->capacity = capacity > 16 ? (RBTreeIndex) capacity + 1 : 16;
+    tree->nodes = (IndexedNode *) malloc(sizeof(IndexedNode) * tree->capacity);
+    if (!tree->nodes) {
+        free(tree);
+        return NULL;
+    }
+
+    /* 哨兵结点: 黑色, 链接均指向自身 */
+    tree->nodes[RBTREE_NIL].left = RBTREE_NIL;
+    tree->nodes[RBTREE_NIL].right = RBTREE_NIL;
+    tree->nodes[RBTREE_NIL].parentColor = BLACK;
+    tree->root = RBTREE_NIL;
+    tree->freeList = RBTREE_NIL;
+    tree->used = 1;
+    tree->count = 0;
+
+    return tree;
+}
+
+/**
+ * 销毁下标链接的红黑树, 整块释放结点数组
+ *
+ * @param[in]  tree: the tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status destroyIndexedRBTree(IndexedRBTree *tree)
+{
+    if (!tree) return FAILED;
+
+    free(tree->nodes);
+    free(tree);
+
+    return SUCCESS;
+}
+
+/* 分配结点下标, 数组扩容后原有下标仍然有效 */
+static RBTreeIndex allocIndexedNode(IndexedRBTree *tree)
+{
+    RBTreeIndex i = tree->freeList;
+
+    if (i != RBTREE_NIL) {
+        tree->freeList = IdxNode(tree, i).right;
+        return i;
+    }
+
+    if (tree->used == tree->capacity) {
+        if (tree->capacity >= INDEXED_MAX_CAPACITY) return RBTREE_NIL;
+        RBTreeIndex capacity = tree->capacity > INDEXED_MAX_CAPACITY / 2 ? INDEXED_MAX_CAPACITY : tree->capacity * 2;
+        IndexedNode *nodes = (IndexedNode *) realloc(tree->nodes, sizeof(IndexedNode) * capacity);
+        if (!nodes) return RBTREE_NIL;
+        tree->nodes = nodes;
+        tree->capacity = capacity;
+    }
+
+    return tree->used++;
+}
+
+static void leftRotate(IndexedRBTree *tree, RBTreeIndex x)
+{
+    RBTreeIndex y = IdxNode(tree, x).right;
+    RBTreeIndex parent = IdxParent(tree, x);
+
+    IdxNode(tree, x).right = IdxNode(tree, y).left;
+    if (IdxNode(tree, y).left != RBTREE_NIL) IdxSetParent(tree, IdxNode(tree, y).left, x);
+
+    IdxSetParent(tree, y, parent);
+    if (parent == RBTREE_NIL) tree->root = y;
+    else if (x == IdxNode(tree, parent).left) IdxNode(tree, parent).left = y;
+    else IdxNode(tree, parent).right = y;
+
+    IdxNode(tree, y).left = x;
+    IdxSetParent(tree, x, y);
+}
+
+static void rightRotate(IndexedRBTree *tree, RBTreeIndex x)
+{
+    RBTreeIndex y = IdxNode(tree, x).left;
+    RBTreeIndex parent = IdxParent(tree, x);
+
+    IdxNode(tree, x).left = IdxNode(tree, y).right;
+    if (IdxNode(tree, y).right != RBTREE_NIL) IdxSetParent(tree, IdxNode(tree, y).right, x);
+
+    IdxSetParent(tree, y, parent);
+    if (parent == RBTREE_NIL) tree->root = y;
+    else if (x == IdxNode(tree, parent).right) IdxNode(tree, parent).right = y;
+    else IdxNode(tree, parent).left = y;
+
+    IdxNode(tree, y).right = x;
+    IdxSetParent(tree, x, y);
+}
+
+/**
+ * 查找数据域为x的结点下标
+ *
+ * @param[in]  tree: the tree
+ * @param[in]  x   : the data of the node
+ * @return  the node index, RBTREE_NIL if not found
+ */
+RBTreeIndex searchIndexedRBTree(IndexedRBTree *tree, RBTreeElemType x)
+{
+    RBTreeIndex i = tree->root;
+
+    while (i != RBTREE_NIL && IdxNode(tree, i).data != x) {
+        i = x < IdxNode(tree, i).data ? IdxNode(tree, i).left : IdxNode(tree, i).right;
+    }
+
+    return i;
+}
+
+/**
+ * 插入数据域为x的结点
+ *
+ * @param[in]  tree: the tree
+ * @param[in]  x   : the data of the node
+ * @return  the operation status, FAILED if x exists or out of memory
+ */
+Status insertIndexedRBTree(IndexedRBTree *tree, RBTreeElemType x)
+{
+    RBTreeIndex parent = RBTREE_NIL, i = tree->root, z;
+
+    while (i != RBTREE_NIL) {
+        parent = i;
+        if (x < IdxNode(tree, i).data) i = IdxNode(tree, i).left;
+        else if (x > IdxNode(tree, i).data) i = IdxNode(tree, i).right;
+        else return FAILED;
+    }
+
+    z = allocIndexedNode(tree);
+    if (z == RBTREE_NIL) return FAILED;
+
+    IdxNode(tree, z).data = x;
+    IdxNode(tree, z).left = RBTREE_NIL;
+    IdxNode(tree, z).right = RBTREE_NIL;
+    IdxNode(tree, z).parentColor = (parent << 1) | RED;
+    if (parent == RBTREE_NIL) tree->root = z;
+    else if (x < IdxNode(tree, parent).data) IdxNode(tree, parent).left = z;
+    else IdxNode(tree, parent).right = z;
+
+    /* 插入后自平衡, 哨兵结点为黑色, 无需判空 */
+    while (IdxColor(tree, IdxParent(tree, z)) == RED) {
+        RBTreeIndex p = IdxParent(tree, z), g = IdxParent(tree, p), uncle;
+
+        if (p == IdxNode(tree, g).left) {
+            uncle = IdxNode(tree, g).right;
+            if (IdxColor(tree, uncle) == RED) {
+                IdxSetColor(tree, p, BLACK);
+                IdxSetColor(tree, uncle, BLACK);
+                IdxSetColor(tree, g, RED);
+                z = g;
+                continue;
+            }
+            if (z == IdxNode(tree, p).right) {
+                z = p;
+                leftRotate(tree, z);
+                p = IdxParent(tree, z);
+            }
+            IdxSetColor(tree, p, BLACK);
+            IdxSetColor(tree, g, RED);
+            rightRotate(tree, g);
+        } else {
+            uncle = IdxNode(tree, g).left;
+            if (IdxColor(tree, uncle) == RED) {
+                IdxSetColor(tree, p, BLACK);
+                IdxSetColor(tree, uncle, BLACK);
+                IdxSetColor(tree, g, RED);
+                z = g;
+                continue;
+            }
+            if (z == IdxNode(tree, p).left) {
+                z = p;
+                rightRotate(tree, z);
+                p = IdxParent(tree, z);
+            }
+            IdxSetColor(tree, p, BLACK);
+            IdxSetColor(tree, g, RED);
+            leftRotate(tree, g);
+        }
+    }
+    IdxSetColor(tree, tree->root, BLACK);
+    tree->count++;
+
+    return SUCCESS;
+}
+
+/* 用以v为根的子树替换以u为根的子树, v可以是哨兵结点 */
+static void transplant(IndexedRBTree *tree, RBTreeIndex u, RBTreeIndex v)
+{
+    RBTreeIndex parent = IdxParent(tree, u);
+
+    if (parent == RBTREE_NIL) tree->root = v;
+    else if (u == IdxNode(tree, parent).left) IdxNode(tree, parent).left = v;
+    else IdxNode(tree, parent).right = v;
+    IdxSetParent(tree, v, parent);
+}
+
+/* 删除结点后自平衡 */
+static void deleteFixup(IndexedRBTree *tree, RBTreeIndex x)
+{
+    while (x != tree->root && IdxColor(tree, x) == BLACK) {
+        RBTreeIndex parent = IdxParent(tree, x), sibling;
+
+        if (x == IdxNode(tree, parent).left) {
+            sibling = IdxNode(tree, parent).right;
+            if (IdxColor(tree, sibling) == RED) {
+                IdxSetColor(tree, sibling, BLACK);
+                IdxSetColor(tree, parent, RED);
+                leftRotate(tree, parent);
+                sibling = IdxNode(tree, parent).right;
+            }
+            if (IdxColor(tree, IdxNode(tree, sibling).left) == BLACK &&
+                IdxColor(tree, IdxNode(tree, sibling).right) == BLACK) {
+                IdxSetColor(tree, sibling, RED);
+                x = parent;
+            } else {
+                if (IdxColor(tree, IdxNode(tree, sibling).right) == BLACK) {
+                    IdxSetColor(tree, IdxNode(tree, sibling).left, BLACK);
+                    IdxSetColor(tree, sibling, RED);
+                    rightRotate(tree, sibling);
+                    sibling = IdxNode(tree, parent).right;
+                }
+                IdxSetColor(tree, sibling, IdxColor(tree, parent));
+                IdxSetColor(tree, parent, BLACK);
+                IdxSetColor(tree, IdxNode(tree, sibling).right, BLACK);
+                leftRotate(tree, parent);
+                x = tree->root;
+            }
+        } else {
+            sibling = IdxNode(tree, parent).left;
+            if (IdxColor(tree, sibling) == RED) {
+                IdxSetColor(tree, sibling, BLACK);
+                IdxSetColor(tree, parent, RED);
+                rightRotate(tree, parent);
+                sibling = IdxNode(tree, parent).left;
+            }
+            if (IdxColor(tree, IdxNode(tree, sibling).left) == BLACK &&
+                IdxColor(tree, IdxNode(tree, sibling).right) == BLACK) {
+                IdxSetColor(tree, sibling, RED);
+                x = parent;
+            } else {
+                if (IdxColor(tree, IdxNode(tree, sibling).left) == BLACK) {
+                    IdxSetColor(tree, IdxNode(tree, sibling).right, BLACK);
+                    IdxSetColor(tree, sibling, RED);
+                    leftRotate(tree, sibling);
+                    sibling = IdxNode(tree, parent).left;
+                }
+                IdxSetColor(tree, sibling, IdxColor(tree, parent));
+                IdxSetColor(tree, parent, BLACK);
+                IdxSetColor(tree, IdxNode(tree, sibling).left, BLACK);
+                rightRotate(tree, parent);
+                x = tree->root;
+            }
+        }
+    }
+    IdxSetColor(tree, x, BLACK);
+}
+
+/**
+ * 删除数据域为x的结点, 结点下标归还空闲链表
+ *
+ * @param[in]  tree: the tree
+ * @param[in]  x   : the data of the node
+ * @return  the operation status, FAILED if x does not exist
+ */
+Status deleteIndexedRBTree(IndexedRBTree *tree, RBTreeElemType x)
+{
+    RBTreeIndex z = searchIndexedRBTree(tree, x), y, child;
+    unsigned int color;
+
+    if (z == RBTREE_NIL) return FAILED;
+
+    y = z;
+    color = IdxColor(tree, y);
+    if (IdxNode(tree, z).left == RBTREE_NIL) {
+        child = IdxNode(tree, z).right;
+        transplant(tree, z, child);
+    } else if (IdxNode(tree, z).right == RBTREE_NIL) {
+        child = IdxNode(tree, z).left;
+        transplant(tree, z, child);
+    } else {
+        /* 后继结点y替代z */
+        y = IdxNode(tree, z).right;
+        while (IdxNode(tree, y).left != RBTREE_NIL) y = IdxNode(tree, y).left;
+        color = IdxColor(tree, y);
+        child = IdxNode(tree, y).right;
+        if (IdxParent(tree, y) == z) IdxSetParent(tree, child, y);
+        else {
+            transplant(tree, y, child);
+            IdxNode(tree, y).right = IdxNode(tree, z).right;
+            IdxSetParent(tree, IdxNode(tree, y).right, y);
+        }
+        transplant(tree, z, y);
+        IdxNode(tree, y).left = IdxNode(tree, z).left;
+        IdxSetParent(tree, IdxNode(tree, y).left, y);
+        IdxSetColor(tree, y, IdxColor(tree, z));
+    }
+    if (color == BLACK) deleteFixup(tree, child);
+
+    /* 哨兵结点的父结点可能被临时修改, 恢复为黑色空链接 */
+    IdxNode(tree, RBTREE_NIL).parentColor = BLACK;
+
+    IdxNode(tree, z).right = tree->freeList;
+    tree->freeList = z;
+    tree->count--;
+
+    return SUCCESS;
+}
+
+/**
+ * 查找最小结点下标
+ *
+ * @param[in]  tree: the tree
+ * @return  the node index, RBTREE_NIL if the tree is empty
+ */
+RBTreeIndex minIndexedRBTree(IndexedRBTree *tree)
+{
+    RBTreeIndex i = tree->root;
+
+    if (i != RBTREE_NIL) {
+        while (IdxNode(tree, i).left != RBTREE_NIL) i = IdxNode(tree, i).left;
+    }
+
+    return i;
+}
+
+/**
+ * 查找后继结点下标
+ *
+ * @param[in]  tree: the tree
+ * @param[in]  i   : the current node index
+ * @return  the successor index, RBTREE_NIL if i is the maximum
+ */
+RBTreeIndex nextIndexedRBTree(IndexedRBTree *tree, RBTreeIndex i)
+{
+    RBTreeIndex p;
+
+    if (IdxNode(tree, i).right != RBTREE_NIL) {
+        i = IdxNode(tree, i).right;
+        while (IdxNode(tree, i).left != RBTREE_NIL) i = IdxNode(tree, i).left;
+        return i;
+    }
+
+    p = IdxParent(tree, i);
+    while (p != RBTREE_NIL && i == IdxNode(tree, p).right) {
+        i = p;
+        p = IdxParent(tree, p);
+    }
+
+    return p;
+}
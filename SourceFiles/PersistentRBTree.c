@@ -0,0 +1,476 @@
+/**
+ * @filename PersistentRBTree.c
+ * @description Persistent (path-copying) Red-Black tree interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 结点按引用计数共享. 引用计数为1的结点只被当前版本通过一条全部独占的路径引用,
+ * 可以原地修改; 其余结点写前先复制, 复制品引用原结点的孩子结点.
+ * 取快照只增加根结点的引用计数, 之后每次写操作至多复制O(log n)个结点,
+ * 最后一个引用某个旧结点的快照释放时该结点随之释放.
+ */
+
+#include <stdlib.h>
+#include "../HeaderFiles/PersistentRBTree.h"
+
+#define PersistentIsRed(n) ((n) && (n)->color == RED) /* 空结点视为黑色 */
+
+/* 增加结点的引用计数 */
+static void retainNode(PersistentNode *node)
+{
+    if (node) __atomic_add_fetch(&node->refCount, 1, __ATOMIC_RELAXED);
+}
+
+/* 减少结点的引用计数, 归零时释放结点并减少孩子结点的引用计数 */
+static void releaseNode(PersistentNode *node)
+{
+    /* 右孩子结点循环处理, 递归深度不超过树高 */
+    while (node && __atomic_sub_fetch(&node->refCount, 1, __ATOMIC_ACQ_REL) == 0) {
+        PersistentNode *right = node->right;
+        releaseNode(node->left);
+        free(node);
+        node = right;
+    }
+}
+
+/**
+ * 预留一次写操作最多需要的结点: 新结点, 复制的查找路径, 以及自平衡时复制的兄弟结点和侄子结点.
+ * 树高不超过2log(n + 1), 每层至多复制4个结点
+ *
+ * @param[in]  tree: the persistent red-black tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+static Status reserveNodes(PersistentRBTree *tree)
+{
+    int bits = 0;
+
+    while (bits < 31 && (1 << bits) <= tree->size) bits++;
+    while (tree->spareCount < 8 * bits + 4) {
+        PersistentNode *node = (PersistentNode *) malloc(sizeof(PersistentNode));
+        if (!node) return FAILED;
+        node->left = tree->spare;
+        tree->spare = node;
+        tree->spareCount++;
+    }
+
+    return SUCCESS;
+}
+
+/* 取出一个预留的结点 */
+static PersistentNode *takeNode(PersistentRBTree *tree)
+{
+    PersistentNode *node = tree->spare;
+
+    tree->spare = node->left;
+    tree->spareCount--;
+    node->refCount = 1;
+
+    return node;
+}
+
+/**
+ * 使link指向的结点可以原地修改, 结点被快照共享时以复制品替换
+ *
+ * @param[in]  tree: the persistent red-black tree
+ * @param[in]  link: the link to the node in an exclusively owned parent, or the root link
+ * @return  the exclusively owned node
+ */
+static PersistentNode *unshareNode(PersistentRBTree *tree, PersistentNode **link)
+{
+    PersistentNode *node = *link, *copy;
+
+    if (__atomic_load_n(&node->refCount, __ATOMIC_ACQUIRE) == 1) return node;
+
+    copy = takeNode(tree);
+    copy->data = node->data;
+    copy->color = node->color;
+    copy->left = node->left;
+    copy->right = node->right;
+    retainNode(copy->left);
+    retainNode(copy->right);
+    *link = copy;
+    releaseNode(node);
+
+    return copy;
+}
+
+/**
+ * 路径上path[d]是node的父结点, d < 0表示node是根结点
+ *
+ * @param[in]  tree: the persistent red-black tree
+ * @param[in]  path: the ancestors from the root
+ * @param[in]  d   : the index of the parent in path
+ * @param[in]  node: the child node
+ * @return  the link to node
+ */
+static PersistentNode **childLink(PersistentRBTree *tree, PersistentNode **path, int d, PersistentNode *node)
+{
+    if (d < 0) return &tree->root;
+
+    return path[d]->left == node ? &path[d]->left : &path[d]->right;
+}
+
+/* 左旋, node和其右孩子结点必须是独占的 */
+static void rotateLeft(PersistentNode **link, PersistentNode *node)
+{
+    PersistentNode *right = node->right;
+
+    node->right = right->left;
+    right->left = node;
+    *link = right;
+}
+
+/* 右旋, node和其左孩子结点必须是独占的 */
+static void rotateRight(PersistentNode **link, PersistentNode *node)
+{
+    PersistentNode *left = node->left;
+
+    node->left = left->right;
+    left->right = node;
+    *link = left;
+}
+
+static PersistentNode *searchNode(PersistentNode *node, RBTreeElemType x)
+{
+    while (node && node->data != x) node = x < node->data ? node->left : node->right;
+
+    return node;
+}
+
+/**
+ * 创建持久化红黑树
+ *
+ * @param[in]  none
+ * @return  the persistent red-black tree, NULL if out of memory
+ */
+PersistentRBTree *createPersistentRBTree()
+{
+    PersistentRBTree *tree = (PersistentRBTree *) malloc(sizeof(PersistentRBTree));
+    if (!tree) return NULL;
+
+    tree->root = NULL;
+    tree->size = 0;
+    tree->spare = NULL;
+    tree->spareCount = 0;
+
+    return tree;
+}
+
+/**
+ * 销毁持久化红黑树, 尚未释放的快照仍然有效
+ *
+ * @param[in]  tree: the persistent red-black tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status destroyPersistentRBTree(PersistentRBTree *tree)
+{
+    if (!tree) return FAILED;
+
+    releaseNode(tree->root);
+    while (tree->spare) {
+        PersistentNode *next = tree->spare->left;
+        free(tree->spare);
+        tree->spare = next;
+    }
+    free(tree);
+
+    return SUCCESS;
+}
+
+/**
+ * 持久化红黑树查找数据域为x的结点
+ *
+ * @param[in]  tree: the persistent red-black tree
+ * @param[in]  x   : the data of the node
+ * @return  SUCCESS if found, FAILED otherwise
+ */
+Status searchPersistentRBTree(PersistentRBTree *tree, RBTreeElemType x)
+{
+    return tree && searchNode(tree->root, x) ? SUCCESS : FAILED;
+}
+
+/**
+ * 持久化红黑树插入数据域为x的结点, 只复制查找路径上和自平衡时改色的被共享结点
+ *
+ * @param[in]  tree: the persistent red-black tree
+ * @param[in]  x   : the data of the node
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status insertPersistentRBTree(PersistentRBTree *tree, RBTreeElemType x)
+{
+    PersistentNode *path[RBTREE_PERSISTENT_MAX_HEIGHT];
+    PersistentNode **link, *node, *parent, *gparent;
+    int d = -1;
+
+    if (!tree || searchNode(tree->root, x)) return FAILED;
+    if (reserveNodes(tree) != SUCCESS) return FAILED;
+
+    for (link = &tree->root; *link;) {
+        node = unshareNode(tree, link);
+        path[++d] = node;
+        link = x < node->data ? &node->left : &node->right;
+    }
+
+    node = takeNode(tree);
+    node->data = x;
+    node->color = RED;
+    node->left = NULL;
+    node->right = NULL;
+    *link = node;
+    tree->size++;
+
+    /* 与RBTreeInsertSelfBalancing相同的自平衡, path[d]是node的父结点 */
+    while (d > 0 && path[d]->color == RED) {
+        parent = path[d];
+        gparent = path[d - 1];
+
+        if (parent == gparent->left) {
+            /* Case 1: 叔叔结点是红色 */
+            if (PersistentIsRed(gparent->right)) {
+                unshareNode(tree, &gparent->right)->color = BLACK;
+                parent->color = BLACK;
+                gparent->color = RED;
+                node = gparent;
+                d -= 2;
+                continue;
+            }
+
+            /* Case 2: 叔叔结点是黑色, 且当前结点是右孩子结点 */
+            if (node == parent->right) {
+                rotateLeft(&gparent->left, parent);
+                parent = node;
+            }
+
+            /* Case 3: 叔叔结点是黑色, 且当前结点是左孩子结点 */
+            parent->color = BLACK;
+            gparent->color = RED;
+            rotateRight(childLink(tree, path, d - 2, gparent), gparent);
+        } else {
+            /* Case 1: 叔叔结点是红色 */
+            if (PersistentIsRed(gparent->left)) {
+                unshareNode(tree, &gparent->left)->color = BLACK;
+                parent->color = BLACK;
+                gparent->color = RED;
+                node = gparent;
+                d -= 2;
+                continue;
+            }
+
+            /* Case 2: 叔叔结点是黑色, 且当前结点是左孩子结点 */
+            if (node == parent->left) {
+                rotateRight(&gparent->right, parent);
+                parent = node;
+            }
+
+            /* Case 3: 叔叔结点是黑色, 且当前结点是右孩子结点 */
+            parent->color = BLACK;
+            gparent->color = RED;
+            rotateLeft(childLink(tree, path, d - 2, gparent), gparent);
+        }
+        break;
+    }
+    tree->root->color = BLACK;
+
+    return SUCCESS;
+}
+
+/**
+ * 持久化红黑树删除数据域为x的结点, 只复制查找路径上和自平衡时修改的被共享结点.
+ * 有两个孩子结点时以后继结点的数据覆盖被删除结点, 改为删除后继结点
+ *
+ * @param[in]  tree: the persistent red-black tree
+ * @param[in]  x   : the data of the node to be deleted
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status deletePersistentRBTree(PersistentRBTree *tree, RBTreeElemType x)
+{
+    PersistentNode *path[RBTREE_PERSISTENT_MAX_HEIGHT];
+    PersistentNode **link = NULL, *node, *target = NULL, *child, *parent, *sibling;
+    int d = -1, color;
+
+    if (!tree || !searchNode(tree->root, x)) return FAILED;
+    if (reserveNodes(tree) != SUCCESS) return FAILED;
+
+    for (link = &tree->root;;) {
+        node = unshareNode(tree, link);
+        path[++d] = node;
+        if (target) {
+            if (!node->left) break;
+            link = &node->left;
+        } else if (x != node->data) {
+            link = x < node->data ? &node->left : &node->right;
+        } else if (node->left && node->right) {
+            target = node;
+            link = &node->right;
+        } else break;
+    }
+    if (target) target->data = node->data;
+
+    /* node至多有一个孩子结点, 由孩子结点填补其位置 */
+    child = node->left ? node->left : node->right;
+    color = node->color;
+    *link = child;
+    free(node);
+    tree->size--;
+    d--;
+
+    /* 与RBTreeDeleteSelfBalancing相同的自平衡, path[d]是child的父结点 */
+    if (color == BLACK) {
+        while (d >= 0 && !PersistentIsRed(child)) {
+            parent = path[d];
+
+            if (child == parent->left) {
+                sibling = unshareNode(tree, &parent->right);
+
+                /* Case 1: 兄弟结点是红色, 旋转后兄弟结点成为路径上的祖先 */
+                if (sibling->color == RED) {
+                    sibling->color = BLACK;
+                    parent->color = RED;
+                    rotateLeft(childLink(tree, path, d - 1, parent), parent);
+                    path[d++] = sibling;
+                    path[d] = parent;
+                    sibling = unshareNode(tree, &parent->right);
+                }
+
+                /* Case 2: 兄弟结点的两个孩子结点都是黑色 */
+                if (!PersistentIsRed(sibling->left) && !PersistentIsRed(sibling->right)) {
+                    sibling->color = RED;
+                    child = parent;
+                    d--;
+                    continue;
+                }
+
+                /* Case 3: 兄弟结点的右孩子结点是黑色 */
+                if (!PersistentIsRed(sibling->right)) {
+                    unshareNode(tree, &sibling->left)->color = BLACK;
+                    sibling->color = RED;
+                    rotateRight(&parent->right, sibling);
+                    sibling = parent->right;
+                }
+
+                /* Case 4: 兄弟结点的右孩子结点是红色 */
+                sibling->color = parent->color;
+                parent->color = BLACK;
+                unshareNode(tree, &sibling->right)->color = BLACK;
+                rotateLeft(childLink(tree, path, d - 1, parent), parent);
+            } else {
+                sibling = unshareNode(tree, &parent->left);
+
+                /* Case 1: 兄弟结点是红色, 旋转后兄弟结点成为路径上的祖先 */
+                if (sibling->color == RED) {
+                    sibling->color = BLACK;
+                    parent->color = RED;
+                    rotateRight(childLink(tree, path, d - 1, parent), parent);
+                    path[d++] = sibling;
+                    path[d] = parent;
+                    sibling = unshareNode(tree, &parent->left);
+                }
+
+                /* Case 2: 兄弟结点的两个孩子结点都是黑色 */
+                if (!PersistentIsRed(sibling->left) && !PersistentIsRed(sibling->right)) {
+                    sibling->color = RED;
+                    child = parent;
+                    d--;
+                    continue;
+                }
+
+                /* Case 3: 兄弟结点的左孩子结点是黑色 */
+                if (!PersistentIsRed(sibling->left)) {
+                    unshareNode(tree, &sibling->right)->color = BLACK;
+                    sibling->color = RED;
+                    rotateLeft(&parent->left, sibling);
+                    sibling = parent->left;
+                }
+
+                /* Case 4: 兄弟结点的左孩子结点是红色 */
+                sibling->color = parent->color;
+                parent->color = BLACK;
+                unshareNode(tree, &sibling->left)->color = BLACK;
+                rotateRight(childLink(tree, path, d - 1, parent), parent);
+            }
+            child = NULL;
+            break;
+        }
+        if (PersistentIsRed(child)) unshareNode(tree, childLink(tree, path, d, child))->color = BLACK;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * 以O(1)时间获取当前版本的快照, 之后的写操作不影响快照.
+ * 快照必须在写者线程中获取, 之后可以交给任意线程读取和释放
+ *
+ * @param[in]  tree: the persistent red-black tree
+ * @return  the snapshot, NULL if out of memory
+ */
+PersistentRBTreeSnapshot *snapshotPersistentRBTree(PersistentRBTree *tree)
+{
+    if (!tree) return NULL;
+
+    PersistentRBTreeSnapshot *snapshot = (PersistentRBTreeSnapshot *) malloc(sizeof(PersistentRBTreeSnapshot));
+    if (!snapshot) return NULL;
+
+    retainNode(tree->root);
+    snapshot->root = tree->root;
+    snapshot->size = tree->size;
+
+    return snapshot;
+}
+
+/**
+ * 释放快照, 只被该快照引用的旧结点随之释放
+ *
+ * @param[in]  snapshot: the snapshot
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status releasePersistentRBTreeSnapshot(PersistentRBTreeSnapshot *snapshot)
+{
+    if (!snapshot) return FAILED;
+
+    releaseNode(snapshot->root);
+    free(snapshot);
+
+    return SUCCESS;
+}
+
+/**
+ * 快照中查找数据域为x的结点
+ *
+ * @param[in]  snapshot: the snapshot
+ * @param[in]  x       : the data of the node
+ * @return  SUCCESS if found, FAILED otherwise
+ */
+Status searchPersistentRBTreeSnapshot(PersistentRBTreeSnapshot *snapshot, RBTreeElemType x)
+{
+    return snapshot && searchNode(snapshot->root, x) ? SUCCESS : FAILED;
+}
+
+/**
+ * 按从小到大的顺序遍历快照, 结点没有父结点指针, 以显式栈代替
+ *
+ * @param[in]  snapshot: the snapshot
+ * @param[in]  visit   : the callback applied to each key, non-zero stops the traversal
+ * @param[in]  arg     : the argument passed to visit
+ * @return  SUCCESS if all keys are visited, FAILED if stopped by visit
+ */
+Status visitPersistentRBTreeSnapshot(PersistentRBTreeSnapshot *snapshot, PersistentRBTreeVisitFunc visit, void *arg)
+{
+    PersistentNode *stack[RBTREE_PERSISTENT_MAX_HEIGHT], *node;
+    int top = 0;
+
+    if (!snapshot || !visit) return FAILED;
+
+    node = snapshot->root;
+    while (node || top > 0) {
+        while (node) {
+            stack[top++] = node;
+            node = node->left;
+        }
+        node = stack[--top];
+        if (visit(node->data, arg)) return FAILED;
+        node = node->right;
+    }
+
+    return SUCCESS;
+}
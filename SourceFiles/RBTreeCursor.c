@@ -0,0 +1,86 @@
+/**
+ * @filename RBTreeCursor.c
+ * @description Red-Black tree cursor interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include <stdio.h>
+#include "../HeaderFiles/RBTreeCursor.h"
+#include "../HeaderFiles/BinarySearchTree.h"
+
+/**
+ * 游标定位到红黑树的最小结点
+ *
+ * @param[out] cursor: the cursor
+ * @param[in]  root  : the root of the red-black tree
+ * @return  SUCCESS if the cursor points to a node, FAILED if the tree is empty
+ */
+Status firstRBTreeCursor(RBTreeCursor *cursor, RBRoot *root)
+{
+    cursor->root = root;
+    cursor->node = root ? minBinarySearchTreeNode(root->node) : NULL;
+
+    return cursor->node ? SUCCESS : FAILED;
+}
+
+/**
+ * 游标定位到红黑树的最大结点
+ *
+ * @param[out] cursor: the cursor
+ * @param[in]  root  : the root of the red-black tree
+ * @return  SUCCESS if the cursor points to a node, FAILED if the tree is empty
+ */
+Status lastRBTreeCursor(RBTreeCursor *cursor, RBRoot *root)
+{
+    cursor->root = root;
+    cursor->node = root ? maxBinarySearchTreeNode(root->node) : NULL;
+
+    return cursor->node ? SUCCESS : FAILED;
+}
+
+/**
+ * 游标定位到第一个数据域不小于x的结点
+ *
+ * @param[out] cursor: the cursor
+ * @param[in]  root  : the root of the red-black tree
+ * @param[in]  x     : the key to seek
+ * @return  SUCCESS if the cursor points to a node, FAILED if all nodes are less than x
+ */
+Status seekRBTreeCursor(RBTreeCursor *cursor, RBRoot *root, RBTreeElemType x)
+{
+    cursor->root = root;
+    cursor->node = root ? BSTreeLowerBound(root->node, x) : NULL;
+
+    return cursor->node ? SUCCESS : FAILED;
+}
+
+/**
+ * 游标移动到后继结点, 越界的游标保持越界
+ *
+ * @param[in]  cursor: the cursor
+ * @return  SUCCESS if the cursor points to a node, FAILED if it moves past the end
+ */
+Status nextRBTreeCursor(RBTreeCursor *cursor)
+{
+    if (!cursor->node) return FAILED;
+
+    cursor->node = BSTreeSuccessor(cursor->node);
+
+    return cursor->node ? SUCCESS : FAILED;
+}
+
+/**
+ * 游标移动到前驱结点, 越界的游标回到最大结点
+ *
+ * @param[in]  cursor: the cursor
+ * @return  SUCCESS if the cursor points to a node, FAILED if it moves before the beginning
+ */
+Status prevRBTreeCursor(RBTreeCursor *cursor)
+{
+    if (!cursor->node) return lastRBTreeCursor(cursor, cursor->root);
+
+    cursor->node = BSTreePrecursor(cursor->node);
+
+    return cursor->node ? SUCCESS : FAILED;
+}
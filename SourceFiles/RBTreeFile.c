@@ -0,0 +1,346 @@
+/**
+ * @filename RBTreeFile.c
+ * @description Red-Black tree binary dump and reload interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 文件格式, 多字节整数均为小端序:
+ *   "RBTS" | 版本(1字节) | 键数(varint) | 每个值的字节数(varint)
+ *   第一个键(zigzag varint) [个数] [值] | 与前一个键之差减1(varint) [个数] [值] | ...
+ *   CRC-32(4字节, 覆盖之前的全部字节)
+ * 多重集合中存在个数大于1的键时版本为RBTREE_FILE_VERSION_COUNTS, 每个键之后记录个数(varint),
+ * 否则不记录个数, 与集合模式的文件相同.
+ * 键按中序递增排列, 相邻键之差通常很小, 多数键只占1到2字节.
+ * 载入时键已经有序, 直接线性时间构建红黑树, 不逐个插入.
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../HeaderFiles/RBTreeFile.h"
+#include "../HeaderFiles/BinarySearchTree.h"
+
+/* 导出时的缓冲写入状态 */
+typedef struct RBTreeFileWriter {
+    FILE *fp;                                 /* 输出文件 */
+    unsigned int crc;                         /* 已写出字节的CRC-32 */
+    int error;                                /* 是否发生过写入错误 */
+    size_t length;                            /* 缓冲区中的字节数 */
+    unsigned char buffer[RBTREE_FILE_BUFFER]; /* 写缓冲区 */
+} RBTreeFileWriter;
+
+/* 按半字节查表的CRC-32(多项式0xEDB88320) */
+static const unsigned int crcTable[16] = {
+        0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu, 0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+        0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu, 0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+};
+
+/**
+ * 计算CRC-32, 与zlib的crc32结果相同
+ *
+ * @param[in]  crc : the CRC of the preceding data, 0 for the first call
+ * @param[in]  data: the data
+ * @param[in]  n   : the number of bytes
+ * @return  the CRC of the preceding data followed by data
+ */
+unsigned int RBTreeCrc32(unsigned int crc, const void *data, size_t n)
+{
+    const unsigned char *p = (const unsigned char *) data;
+
+    crc = ~crc;
+    while (n--) {
+        crc ^= *p++;
+        crc = crcTable[crc & 0x0F] ^ (crc >> 4);
+        crc = crcTable[crc & 0x0F] ^ (crc >> 4);
+    }
+
+    return ~crc;
+}
+
+/**
+ * 将v编码为varint, 每字节7位, 最高位表示后面还有字节
+ *
+ * @param[in]  out: the output, at least 5 bytes
+ * @param[in]  v  : the value
+ * @return  the number of bytes written
+ */
+int RBTreeEncodeVarint(unsigned char *out, unsigned int v)
+{
+    int n = 0;
+
+    while (v >= 0x80) {
+        out[n++] = (unsigned char) (v | 0x80);
+        v >>= 7;
+    }
+    out[n++] = (unsigned char) v;
+
+    return n;
+}
+
+/**
+ * 从[*p, end)解码一个varint
+ *
+ * @param[in]  p  : the read position, advanced on success
+ * @param[in]  end: the end of the input
+ * @param[out] v  : the value
+ * @return  1 on success, 0 if truncated or longer than 32 bits
+ */
+int RBTreeDecodeVarint(const unsigned char **p, const unsigned char *end, unsigned int *v)
+{
+    unsigned int result = 0;
+    int shift;
+
+    for (shift = 0; shift < 35 && *p < end; shift += 7) {
+        unsigned char byte = *(*p)++;
+        if (shift == 28 && byte > 0x0F) return 0;
+        result |= (unsigned int) (byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            *v = result;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * 将整个文件读入内存
+ *
+ * @param[in]  filename: the file
+ * @param[out] size    : the size of the file
+ * @return  the contents to be freed by the caller, NULL if the file cannot be read
+ */
+unsigned char *RBTreeReadFile(const char *filename, long *size)
+{
+    unsigned char *data = NULL;
+    FILE *fp = fopen(filename, "rb");
+
+    if (!fp) return NULL;
+    if (fseek(fp, 0, SEEK_END) == 0 && (*size = ftell(fp)) >= 0 && fseek(fp, 0, SEEK_SET) == 0) {
+        data = (unsigned char *) malloc(*size > 0 ? (size_t) *size : 1);
+        if (data && fread(data, 1, (size_t) *size, fp) != (size_t) *size) {
+            free(data);
+            data = NULL;
+        }
+    }
+    fclose(fp);
+
+    return data;
+}
+
+/* 将缓冲区写入文件, 同时累计CRC */
+static void flushWriter(RBTreeFileWriter *writer)
+{
+    writer->crc = RBTreeCrc32(writer->crc, writer->buffer, writer->length);
+    if (fwrite(writer->buffer, 1, writer->length, writer->fp) != writer->length) writer->error = 1;
+    writer->length = 0;
+}
+
+static void writeBytes(RBTreeFileWriter *writer, const void *data, size_t n)
+{
+    const unsigned char *p = (const unsigned char *) data;
+
+    while (n > 0) {
+        size_t chunk = RBTREE_FILE_BUFFER - writer->length;
+        if (chunk == 0) {
+            flushWriter(writer);
+            continue;
+        }
+        if (chunk > n) chunk = n;
+        memcpy(writer->buffer + writer->length, p, chunk);
+        writer->length += chunk;
+        p += chunk;
+        n -= chunk;
+    }
+}
+
+static void writeVarint(RBTreeFileWriter *writer, unsigned int v)
+{
+    if (RBTREE_FILE_BUFFER - writer->length < 5) flushWriter(writer);
+
+    writer->length += (size_t) RBTreeEncodeVarint(writer->buffer + writer->length, v);
+}
+
+/**
+ * 将红黑树导出到文件, 只包含键
+ *
+ * @param[in]  root    : the root of the red-black tree
+ * @param[in]  filename: the output file
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status dumpRBTree(RBRoot *root, const char *filename)
+{
+    return dumpRBTreeWithValues(root, filename, 0, NULL, NULL);
+}
+
+/**
+ * 由文件载入红黑树, 文件中的值被忽略, 红黑树必须为空
+ *
+ * @param[in]  root    : the root of the red-black tree
+ * @param[in]  filename: the input file
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status loadRBTree(RBRoot *root, const char *filename)
+{
+    return loadRBTreeWithValues(root, filename, 0, NULL, NULL);
+}
+
+/**
+ * 将红黑树按中序导出到文件, 每个键之后跟随dump取出的valueSize字节的值.
+ * 多重集合模式下同时导出每个键的个数, 区间树模式下返回FAILED. 导出失败时删除不完整的文件
+ *
+ * @param[in]  root     : the root of the red-black tree
+ * @param[in]  filename : the output file
+ * @param[in]  valueSize: the size of each value in bytes, 0 means keys only
+ * @param[in]  dump     : the callback filling the value of a node, required if valueSize > 0
+ * @param[in]  arg      : the argument passed to dump
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status dumpRBTreeWithValues(RBRoot *root, const char *filename, int valueSize, RBTreeDumpValueFunc dump, void *arg)
+{
+    RBTreeFileWriter *writer;
+    unsigned char *value = NULL, trailer[4];
+    unsigned char version = RBTREE_FILE_VERSION;
+    unsigned int count = 0, crc;
+    RBTreeElemType prev = 0;
+    Node *first, *node;
+    int i;
+
+    /* 区间树的左端点可以重复且文件不记录右端点, 不能导出 */
+    if (RBTREE_INTERVAL || !root || !filename || valueSize < 0 || (valueSize > 0 && !dump)) return FAILED;
+
+    writer = (RBTreeFileWriter *) malloc(sizeof(RBTreeFileWriter));
+    if (valueSize > 0) value = (unsigned char *) malloc((size_t) valueSize);
+    if (!writer || (valueSize > 0 && !value) || !(writer->fp = fopen(filename, "wb"))) {
+        free(writer);
+        free(value);
+        return FAILED;
+    }
+    writer->crc = 0;
+    writer->error = 0;
+    writer->length = 0;
+
+    first = minBinarySearchTreeNode(root->node);
+    for (node = first; node; node = BSTreeSuccessor(node)) {
+        count++;
+        if (RBTreeMultiplicity(node) > 1) version = RBTREE_FILE_VERSION_COUNTS;
+    }
+
+    writeBytes(writer, RBTREE_FILE_MAGIC, 4);
+    writeBytes(writer, &version, 1);
+    writeVarint(writer, count);
+    writeVarint(writer, (unsigned int) valueSize);
+
+    for (node = first; node; node = BSTreeSuccessor(node)) {
+        /* 第一个键以zigzag编码支持负数, 之后的键严格递增, 只记录差值减1 */
+        if (node == first) writeVarint(writer, RBTreeZigzagEncode(node->data));
+        else writeVarint(writer, (unsigned int) ((long long) node->data - prev - 1));
+        prev = node->data;
+        if (version == RBTREE_FILE_VERSION_COUNTS) writeVarint(writer, (unsigned int) RBTreeMultiplicity(node));
+        if (valueSize > 0) {
+            dump(node, value, arg);
+            writeBytes(writer, value, (size_t) valueSize);
+        }
+    }
+    flushWriter(writer);
+
+    crc = writer->crc;
+    for (i = 0; i < 4; i++) trailer[i] = (unsigned char) (crc >> (8 * i));
+    if (fwrite(trailer, 1, 4, writer->fp) != 4) writer->error = 1;
+    if (fclose(writer->fp) != 0) writer->error = 1;
+    if (writer->error) remove(filename);
+
+    i = writer->error;
+    free(writer);
+    free(value);
+
+    return i ? FAILED : SUCCESS;
+}
+
+/**
+ * 由文件载入红黑树, 校验CRC后解码有序的键并线性时间构建, 再按中序把值交给load.
+ * 红黑树必须为空, 文件损坏或与valueSize不符时返回FAILED且红黑树保持为空.
+ * 记录了个数的文件只能在多重集合模式下载入, 区间树模式下返回FAILED
+ *
+ * @param[in]  root     : the root of the red-black tree
+ * @param[in]  filename : the input file
+ * @param[in]  valueSize: the expected size of each value in bytes, ignored if load is NULL
+ * @param[in]  load     : the callback receiving the value of each node, NULL to skip values
+ * @param[in]  arg      : the argument passed to load
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status loadRBTreeWithValues(RBRoot *root, const char *filename, int valueSize, RBTreeLoadValueFunc load, void *arg)
+{
+    unsigned char *data, *values = NULL;
+    const unsigned char *p, *end;
+    RBTreeElemType *keys = NULL;
+    int *counts = NULL;
+    unsigned int count, fileValueSize, code, crc, i, keyBytes = 1;
+    long long key = 0;
+    long size;
+    Node *node;
+    Status status = FAILED;
+
+    if (RBTREE_INTERVAL || !root || root->node || !filename || valueSize < 0) return FAILED;
+    if (!(data = RBTreeReadFile(filename, &size))) return FAILED;
+    if (size < 4 + 1 + 2 + 4) goto cleanup;
+
+    p = data;
+    end = data + size - 4;
+    crc = (unsigned int) end[0] | (unsigned int) end[1] << 8 | (unsigned int) end[2] << 16 | (unsigned int) end[3] << 24;
+    if (RBTreeCrc32(0, data, (size_t) (size - 4)) != crc) goto cleanup;
+    if (memcmp(p, RBTREE_FILE_MAGIC, 4) != 0) goto cleanup;
+    if (RBTREE_MULTISET && p[4] == RBTREE_FILE_VERSION_COUNTS) keyBytes = 2;
+    else if (p[4] != RBTREE_FILE_VERSION) goto cleanup;
+    p += 5;
+    if (!RBTreeDecodeVarint(&p, end, &count) || !RBTreeDecodeVarint(&p, end, &fileValueSize)) goto cleanup;
+    if (count > INT_MAX || (load && fileValueSize != (unsigned int) valueSize)) goto cleanup;
+
+    /* 每个键至少占1字节, 个数也至少占1字节, 据此在分配内存前检查键数 */
+    if (count > (unsigned long long) (end - p) / (keyBytes + (unsigned long long) fileValueSize)) goto cleanup;
+    if (count > 0) {
+        keys = (RBTreeElemType *) malloc(sizeof(RBTreeElemType) * count);
+        if (!keys) goto cleanup;
+        if (keyBytes > 1) {
+            counts = (int *) malloc(sizeof(int) * count);
+            if (!counts) goto cleanup;
+        }
+        if (load && valueSize > 0) {
+            values = (unsigned char *) malloc((size_t) count * (size_t) valueSize);
+            if (!values) goto cleanup;
+        }
+    }
+
+    for (i = 0; i < count; i++) {
+        if (!RBTreeDecodeVarint(&p, end, &code)) goto cleanup;
+        if (i == 0) key = RBTreeZigzagDecode(code);
+        else if ((key += (long long) code + 1) > INT_MAX) goto cleanup;
+        keys[i] = (RBTreeElemType) key;
+        if (counts) {
+            if (!RBTreeDecodeVarint(&p, end, &code) || code < 1 || code > INT_MAX) goto cleanup;
+            counts[i] = (int) code;
+        }
+
+        if ((size_t) (end - p) < fileValueSize) goto cleanup;
+        if (values) memcpy(values + (size_t) i * valueSize, p, fileValueSize);
+        p += fileValueSize;
+    }
+    if (p != end) goto cleanup;
+
+    if (buildRBTreeFromCounts(root, keys, counts, (int) count) != SUCCESS) goto cleanup;
+    if (load) {
+        for (i = 0, node = minBinarySearchTreeNode(root->node); node; node = BSTreeSuccessor(node), i++) {
+            load(node, values ? values + (size_t) i * valueSize : NULL, arg);
+        }
+    }
+    status = SUCCESS;
+
+cleanup:
+    free(values);
+    free(counts);
+    free(keys);
+    free(data);
+
+    return status;
+}
@@ -0,0 +1,202 @@
+/**
+ * @filename RBTreeInterval.c
+ * @description Red-Black interval tree interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 结点按(左端点, 右端点)排序, 左端点相同的区间可以共存, 中序序列按左端点非递减.
+ * 按数据域操作的接口只看左端点, 受到的限制见RBTreeInterval.h. 每个结点维护子树中最大的右端点maxHi,
+ * 由RBTreeAugmentNode在插入, 删除和旋转时更新.
+ * 查询时maxHi小于lo的子树不可能有重叠区间, 左端点大于hi的结点及其右子树也不可能,
+ * 两者都直接跳过.
+ */
+
+#include "../HeaderFiles/RBTreeInterval.h"
+#include "../HeaderFiles/RedBlackTreeUtils.h"
+
+#if RBTREE_INTERVAL
+
+/* 结点的区间与[lo, hi]是否重叠 */
+#define overlaps(node, lo, hi) ((node)->data <= (hi) && (node)->hi >= (lo))
+
+/**
+ * 按(左端点, 右端点)比较区间与结点
+ *
+ * @param[in]  lo  : the low endpoint of the interval
+ * @param[in]  hi  : the high endpoint of the interval
+ * @param[in]  node: the node of the red-black tree
+ * @return  negative if the interval goes before the node, positive if after, 0 if equal
+ */
+static int compareInterval(RBTreeElemType lo, RBTreeElemType hi, Node *node)
+{
+    if (lo != node->data) return lo < node->data ? -1 : 1;
+    if (hi != node->hi) return hi < node->hi ? -1 : 1;
+
+    return 0;
+}
+
+/**
+ * 区间树插入闭区间[lo, hi]
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  lo  : the low endpoint
+ * @param[in]  hi  : the high endpoint
+ * @return  the operation status, SUCCESS is 0, FAILED is -1 if lo > hi, the interval exists or out of memory
+ */
+Status insertIntervalRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi)
+{
+    Node *p, *parent = NULL, *node;
+    int cmp = 0;
+
+    if (!root || lo > hi) return FAILED;
+
+    RBTreeCount(root, searches, 1);
+    for (p = root->node; p; p = cmp < 0 ? p->left : p->right) {
+        RBTreeCount(root, comparisons, 1);
+        cmp = compareInterval(lo, hi, p);
+        if (cmp == 0) return FAILED;
+        parent = p;
+    }
+
+    node = createRBTreeNode(root, lo, parent, NULL, NULL);
+    if (!node) return FAILED;
+    node->hi = hi;
+
+    if (!parent) RBTreeStoreLink(root->node, node);
+    else if (cmp < 0) RBTreeStoreLink(parent->left, node);
+    else RBTreeStoreLink(parent->right, node);
+    if (!root->rightmost || (parent == root->rightmost && cmp > 0)) root->rightmost = node;
+
+    RBTreeSetColor(node, RED);
+    RBTreeAugmentPath(node);
+    RBTreeInsertSelfBalancing(root, node);
+
+    return SUCCESS;
+}
+
+/**
+ * 区间树查找闭区间[lo, hi]
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  lo  : the low endpoint
+ * @param[in]  hi  : the high endpoint
+ * @return  the node of the interval, NULL if not found
+ */
+RBTree searchIntervalRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi)
+{
+    Node *p = root ? root->node : NULL;
+
+    if (root) RBTreeCountShared(root, searches, 1);
+    while (p) {
+        int cmp = compareInterval(lo, hi, p);
+        RBTreeCountShared(root, comparisons, 1);
+        if (cmp == 0) return p;
+        p = cmp < 0 ? p->left : p->right;
+    }
+
+    return NULL;
+}
+
+/**
+ * 区间树删除闭区间[lo, hi]
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  lo  : the low endpoint
+ * @param[in]  hi  : the high endpoint
+ * @return  the operation status, SUCCESS is 0, FAILED is -1 if the interval is not found
+ */
+Status deleteIntervalRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi)
+{
+    Node *node = searchIntervalRBTree(root, lo, hi);
+
+    if (!node) return FAILED;
+
+    return deleteRBTreeNode(root, node);
+}
+
+/**
+ * 区间树查找任意一个与[lo, hi]重叠的区间, O(log n)
+ *
+ * 左子树的maxHi不小于lo时, 若左子树中没有重叠区间, 则右端点为maxHi的区间左端点大于hi,
+ * 右子树的左端点更大, 也不可能重叠, 因此只需沿一条路径下降.
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  lo  : the low endpoint of the query
+ * @param[in]  hi  : the high endpoint of the query
+ * @return  an overlapping interval, NULL if none
+ */
+RBTree findOverlapRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi)
+{
+    Node *p = root ? root->node : NULL;
+
+    while (p && !overlaps(p, lo, hi)) {
+        if (p->left && p->left->maxHi >= lo) p = p->left;
+        else p = p->right;
+    }
+
+    return p;
+}
+
+/**
+ * 按中序访问子树中与[lo, hi]重叠的区间
+ *
+ * @param[in]  node : the subtree root
+ * @param[in]  lo   : the low endpoint of the query
+ * @param[in]  hi   : the high endpoint of the query
+ * @param[in]  visit: the callback, returns non-zero to stop
+ * @param[in]  arg  : the argument passed to visit
+ * @param[out] count: the number of intervals visited
+ * @return  non-zero if visit stopped the traversal
+ */
+static int overlapSubtree(Node *node, RBTreeElemType lo, RBTreeElemType hi, RBTreeVisitFunc visit, void *arg,
+                          int *count)
+{
+    if (!node || node->maxHi < lo) return 0;
+
+    if (overlapSubtree(node->left, lo, hi, visit, arg, count)) return 1;
+    if (node->data > hi) return 0;
+    if (node->hi >= lo) {
+        ++*count;
+        if (visit && visit(node, arg)) return 1;
+    }
+
+    return overlapSubtree(node->right, lo, hi, visit, arg, count);
+}
+
+/**
+ * 区间树按左端点顺序遍历所有与[lo, hi]重叠的区间.
+ * 只进入maxHi不小于lo且可能含有左端点不大于hi的结点的子树, 访问的结点数与结果数k成正比,
+ * 最坏为O(log n + k log(n / k)), 远少于扫描全部n个区间
+ *
+ * @param[in]  root : the root of the red-black tree
+ * @param[in]  lo   : the low endpoint of the query
+ * @param[in]  hi   : the high endpoint of the query
+ * @param[in]  visit: the callback, returns non-zero to stop, NULL only counts
+ * @param[in]  arg  : the argument passed to visit
+ * @return  the number of intervals visited, 0 if root is NULL or lo > hi
+ */
+int overlapRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi, RBTreeVisitFunc visit, void *arg)
+{
+    int count = 0;
+
+    if (!root || lo > hi) return 0;
+    overlapSubtree(root->node, lo, hi, visit, arg, &count);
+
+    return count;
+}
+
+/**
+ * 区间树按左端点顺序遍历所有包含t的区间
+ *
+ * @param[in]  root : the root of the red-black tree
+ * @param[in]  t    : the point
+ * @param[in]  visit: the callback, returns non-zero to stop, NULL only counts
+ * @param[in]  arg  : the argument passed to visit
+ * @return  the number of intervals visited, 0 if root is NULL
+ */
+int stabRBTree(RBRoot *root, RBTreeElemType t, RBTreeVisitFunc visit, void *arg)
+{
+    return overlapRBTree(root, t, t, visit, arg);
+}
+
+#endif /* RBTREE_INTERVAL */
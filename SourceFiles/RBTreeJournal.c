@@ -0,0 +1,444 @@
+/**
+ * @filename RBTreeJournal.c
+ * @description Red-Black tree write-ahead log interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 日志文件格式:
+ *   "RBTJ" | 版本(1字节) | 帧 | 帧 | ...
+ *   帧: 记录字节数(varint) | 记录 | CRC-32(4字节小端序, 覆盖记录)
+ *   记录: 操作种类(1字节) | 键(zigzag varint)
+ * 每次提交把尚未提交的全部操作写成一帧并落盘一次, 即组提交.
+ * 检查点是dumpRBTree导出的完整红黑树, 写出后清空日志.
+ * 插入和删除都把一个键置为确定的状态, 重放是幂等的: 写完检查点但清空日志前崩溃,
+ * 重放已包含在检查点中的日志仍得到相同的红黑树.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../HeaderFiles/RBTreeJournal.h"
+#include "../HeaderFiles/RBTreeFile.h"
+#include "../HeaderFiles/RedBlackTreeUtils.h"
+#include "../HeaderFiles/BinarySearchTree.h"
+
+#ifdef _WIN32
+#include <io.h>
+#define syncFile(fp) _commit(_fileno(fp))
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#define syncFile(fp) fsync(fileno(fp))
+#endif
+
+#define RBTREE_JOURNAL_RECORD_MAX 6 /* 一条记录的最大字节数 */
+
+static char *copyString(const char *s)
+{
+    char *copy = (char *) malloc(strlen(s) + 1);
+    if (copy) strcpy(copy, s);
+
+    return copy;
+}
+
+static int fileExists(const char *filename)
+{
+    FILE *fp = fopen(filename, "rb");
+    if (!fp) return 0;
+
+    fclose(fp);
+
+    return 1;
+}
+
+/* 将已写入的文件内容落盘 */
+static Status syncPath(const char *filename)
+{
+    FILE *fp = fopen(filename, "ab");
+    Status status;
+
+    if (!fp) return FAILED;
+    status = fflush(fp) == 0 && syncFile(fp) == 0 ? SUCCESS : FAILED;
+    if (fclose(fp) != 0) status = FAILED;
+
+    return status;
+}
+
+/* 将文件所在目录的目录项落盘, 使此前的rename在掉电后仍然有效 */
+static Status syncDirectory(const char *filename)
+{
+#ifdef _WIN32
+    /* Windows不支持打开并落盘目录, rename的持久性由文件系统日志保证 */
+    (void) filename;
+
+    return SUCCESS;
+#else
+    const char *slash = strrchr(filename, '/');
+    char *directory;
+    Status status = FAILED;
+    int fd;
+
+    if (!slash) directory = copyString(".");
+    else if (slash == filename) directory = copyString("/");
+    else if ((directory = (char *) malloc((size_t) (slash - filename) + 1))) {
+        memcpy(directory, filename, (size_t) (slash - filename));
+        directory[slash - filename] = '\0';
+    }
+    if (!directory) return FAILED;
+
+    fd = open(directory, O_RDONLY);
+    if (fd >= 0) {
+        if (fsync(fd) == 0) status = SUCCESS;
+        close(fd);
+    }
+    free(directory);
+
+    return status;
+#endif
+}
+
+/**
+ * 以from替换to, 同一文件系统内的rename是原子的.
+ * 替换后将目录落盘: 否则掉电后可能出现rename丢失而随后的日志清空已落盘,
+ * 恢复时旧检查点配空日志, 丢失自旧检查点以来的全部操作
+ */
+static Status replaceFile(const char *from, const char *to)
+{
+#ifdef _WIN32
+    /* Windows下rename不覆盖已存在的文件, 先删除旧文件; 此时崩溃由openRBTreeJournal改用临时文件恢复 */
+    remove(to);
+#endif
+
+    if (rename(from, to) != 0) return FAILED;
+
+    return syncDirectory(to);
+}
+
+/* 检查点的临时文件名 */
+static char *tempName(const char *filename)
+{
+    char *temp = (char *) malloc(strlen(filename) + 5);
+    if (temp) {
+        strcpy(temp, filename);
+        strcat(temp, ".tmp");
+    }
+
+    return temp;
+}
+
+/* 新建只有文件头的日志并落盘, 返回以追加方式打开的日志 */
+static FILE *startLog(const char *filename)
+{
+    unsigned char version = RBTREE_JOURNAL_VERSION;
+    FILE *fp = fopen(filename, "wb");
+
+    if (!fp) return NULL;
+    if (fwrite(RBTREE_JOURNAL_MAGIC, 1, 4, fp) != 4 || fwrite(&version, 1, 1, fp) != 1
+        || fflush(fp) != 0 || syncFile(fp) != 0) {
+        fclose(fp);
+        return NULL;
+    }
+
+    return fp;
+}
+
+/**
+ * 解码一帧中的记录, apply为1时同时应用到红黑树
+ *
+ * @param[in]  journal: the journal
+ * @param[in]  p      : the first record of the frame
+ * @param[in]  end    : the end of the frame
+ * @param[in]  apply  : 1 to apply the records, 0 to validate only
+ * @return  the number of records, -1 if the frame is malformed
+ */
+static int replayFrame(RBTreeJournal *journal, const unsigned char *p, const unsigned char *end, int apply)
+{
+    unsigned int code;
+    int count = 0;
+
+    while (p < end) {
+        unsigned char op = *p++;
+        if ((op != RBTREE_JOURNAL_INSERT && op != RBTREE_JOURNAL_DELETE) || !RBTreeDecodeVarint(&p, end, &code)) {
+            return -1;
+        }
+        if (apply) {
+            if (op == RBTREE_JOURNAL_INSERT) insertRBTree(journal->root, RBTreeZigzagDecode(code));
+            else deleteRBTree(journal->root, RBTreeZigzagDecode(code));
+        }
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * 重放日志中完整且校验通过的帧, 遇到不完整的尾部即停止
+ *
+ * @param[in]  journal: the journal
+ * @return  1 if the whole log is replayed, 0 if it is missing or has a torn tail, -1 if it is not a journal
+ */
+static int replayLog(RBTreeJournal *journal)
+{
+    const unsigned char *p, *end;
+    unsigned char *data;
+    long size;
+    int clean;
+
+    if (!(data = RBTreeReadFile(journal->logFile, &size))) return fileExists(journal->logFile) ? -1 : 0;
+
+    /* 文件头不完整说明新建日志时崩溃, 之前的日志已包含在检查点中 */
+    if (size < 5) {
+        free(data);
+        return 0;
+    }
+    if (memcmp(data, RBTREE_JOURNAL_MAGIC, 4) != 0 || data[4] != RBTREE_JOURNAL_VERSION) {
+        free(data);
+        return -1;
+    }
+
+    p = data + 5;
+    end = data + size;
+    while (p < end) {
+        const unsigned char *frame = p;
+        unsigned int length, crc;
+        int count;
+
+        if (!RBTreeDecodeVarint(&frame, end, &length) || (size_t) (end - frame) < (size_t) length + 4) break;
+        crc = (unsigned int) frame[length] | (unsigned int) frame[length + 1] << 8
+              | (unsigned int) frame[length + 2] << 16 | (unsigned int) frame[length + 3] << 24;
+        if (RBTreeCrc32(0, frame, length) != crc) break;
+
+        /* 整帧校验通过后才应用, 一次组提交要么全部恢复要么全部丢弃 */
+        if ((count = replayFrame(journal, frame, frame + length, 0)) < 0) break;
+        replayFrame(journal, frame, frame + length, 1);
+        journal->sinceCheckpoint += count;
+        p = frame + length + 4;
+    }
+    clean = p == end;
+    free(data);
+
+    return clean;
+}
+
+/* 由检查点恢复红黑树, 检查点不存在时从空树开始 */
+static Status loadCheckpoint(RBTreeJournal *journal)
+{
+    char *temp;
+
+    if (fileExists(journal->checkpointFile)) return loadRBTree(journal->root, journal->checkpointFile);
+
+    /* 替换检查点时旧检查点已删除而临时文件尚未改名, 临时文件已落盘且有校验 */
+    if (!(temp = tempName(journal->checkpointFile))) return FAILED;
+    if (fileExists(temp)) loadRBTree(journal->root, temp);
+    free(temp);
+
+    return SUCCESS;
+}
+
+/* 保证记录缓冲区能再容纳一条记录 */
+static Status reserveRecord(RBTreeJournal *journal)
+{
+    if (journal->capacity - journal->length >= RBTREE_JOURNAL_RECORD_MAX) return SUCCESS;
+
+    size_t capacity = journal->capacity ? journal->capacity * 2 : 256;
+    unsigned char *buffer = (unsigned char *) realloc(journal->buffer, capacity);
+    if (!buffer) return FAILED;
+
+    journal->buffer = buffer;
+    journal->capacity = capacity;
+
+    return SUCCESS;
+}
+
+static void appendRecord(RBTreeJournal *journal, RBTreeJournalOp op, RBTreeElemType x)
+{
+    journal->buffer[journal->length++] = (unsigned char) op;
+    journal->length += (size_t) RBTreeEncodeVarint(journal->buffer + journal->length, RBTreeZigzagEncode(x));
+    journal->pending++;
+}
+
+/* 将尚未提交的记录写成一帧并落盘 */
+static Status writeFrame(RBTreeJournal *journal)
+{
+    unsigned char header[5], trailer[4];
+    unsigned int crc = RBTreeCrc32(0, journal->buffer, journal->length);
+    size_t n = (size_t) RBTreeEncodeVarint(header, (unsigned int) journal->length);
+    int i;
+
+    for (i = 0; i < 4; i++) trailer[i] = (unsigned char) (crc >> (8 * i));
+    if (fwrite(header, 1, n, journal->log) != n
+        || fwrite(journal->buffer, 1, journal->length, journal->log) != journal->length
+        || fwrite(trailer, 1, 4, journal->log) != 4 || fflush(journal->log) != 0 || syncFile(journal->log) != 0) {
+        /* 可能已写出半帧, 之后追加的帧在重放时不可达, 不再接受操作 */
+        journal->broken = 1;
+        return FAILED;
+    }
+    journal->sinceCheckpoint += journal->pending;
+    journal->length = 0;
+    journal->pending = 0;
+
+    return SUCCESS;
+}
+
+/**
+ * 打开日志: 先载入检查点, 再重放日志尾部. 日志缺失或尾部不完整时立即做一次检查点,
+ * 使之后追加的帧紧接在有效内容之后
+ *
+ * @param[in]  root              : the empty red-black tree to recover into
+ * @param[in]  logFile           : the log file
+ * @param[in]  checkpointFile    : the checkpoint file
+ * @param[in]  groupSize         : the number of operations per group commit, <= 0 means 1
+ * @param[in]  checkpointInterval: the number of committed operations between automatic checkpoints,
+ *                                 <= 0 means once the log holds as many operations as the tree has nodes
+ * @return  the journal, NULL if the files cannot be used (the tree is left empty) or in interval mode
+ */
+RBTreeJournal *openRBTreeJournal(RBRoot *root, const char *logFile, const char *checkpointFile,
+                                 int groupSize, int checkpointInterval)
+{
+    RBTreeJournal *journal;
+    Node *node;
+    int clean = 0;
+
+    /* 检查点依赖dumpRBTree, 区间树不能记录日志 */
+    if (RBTREE_INTERVAL || !root || root->node || !logFile || !checkpointFile) return NULL;
+
+    journal = (RBTreeJournal *) calloc(1, sizeof(RBTreeJournal));
+    if (!journal) return NULL;
+    journal->root = root;
+    journal->groupSize = groupSize > 0 ? groupSize : 1;
+    journal->checkpointInterval = checkpointInterval;
+    journal->logFile = copyString(logFile);
+    journal->checkpointFile = copyString(checkpointFile);
+    if (!journal->logFile || !journal->checkpointFile || loadCheckpoint(journal) != SUCCESS
+        || (clean = replayLog(journal)) < 0) {
+        closeRBTreeJournal(journal);
+        destroyRBTreeNodes(root, root->node);
+        root->node = NULL;
+        root->rightmost = NULL;
+        return NULL;
+    }
+
+    for (node = minBinarySearchTreeNode(root->node); node; node = BSTreeSuccessor(node)) journal->size++;
+
+    if (clean) journal->log = fopen(logFile, "ab");
+    if (!journal->log && checkpointRBTreeJournal(journal) != SUCCESS) {
+        closeRBTreeJournal(journal);
+        destroyRBTreeNodes(root, root->node);
+        root->node = NULL;
+        root->rightmost = NULL;
+        return NULL;
+    }
+
+    return journal;
+}
+
+/**
+ * 关闭日志, 提交尚未提交的操作, 红黑树不随之销毁
+ *
+ * @param[in]  journal: the journal
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status closeRBTreeJournal(RBTreeJournal *journal)
+{
+    Status status = SUCCESS;
+
+    if (!journal) return FAILED;
+
+    if (journal->log) {
+        status = commitRBTreeJournal(journal);
+        if (fclose(journal->log) != 0) status = FAILED;
+    }
+    free(journal->buffer);
+    free(journal->logFile);
+    free(journal->checkpointFile);
+    free(journal);
+
+    return status;
+}
+
+/**
+ * 插入数据域为x的结点并记录日志, 累计到groupSize个操作时自动提交.
+ * 返回SUCCESS只表示已应用到红黑树, 提交之后才保证持久
+ *
+ * @param[in]  journal: the journal
+ * @param[in]  x      : the data of the node
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status insertRBTreeJournal(RBTreeJournal *journal, RBTreeElemType x)
+{
+    if (!journal || journal->broken || reserveRecord(journal) != SUCCESS) return FAILED;
+    if (insertRBTree(journal->root, x) != SUCCESS) return FAILED;
+
+    appendRecord(journal, RBTREE_JOURNAL_INSERT, x);
+    journal->size++;
+
+    return journal->pending >= journal->groupSize ? commitRBTreeJournal(journal) : SUCCESS;
+}
+
+/**
+ * 删除数据域为x的结点并记录日志, 累计到groupSize个操作时自动提交.
+ * 返回SUCCESS只表示已应用到红黑树, 提交之后才保证持久
+ *
+ * @param[in]  journal: the journal
+ * @param[in]  x      : the data of the node to be deleted
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status deleteRBTreeJournal(RBTreeJournal *journal, RBTreeElemType x)
+{
+    if (!journal || journal->broken || reserveRecord(journal) != SUCCESS) return FAILED;
+    if (deleteRBTree(journal->root, x) != SUCCESS) return FAILED;
+
+    appendRecord(journal, RBTREE_JOURNAL_DELETE, x);
+    journal->size--;
+
+    return journal->pending >= journal->groupSize ? commitRBTreeJournal(journal) : SUCCESS;
+}
+
+/**
+ * 提交尚未提交的操作, 整组只写一帧并落盘一次; 日志足够长时接着做检查点
+ *
+ * @param[in]  journal: the journal
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status commitRBTreeJournal(RBTreeJournal *journal)
+{
+    int interval;
+
+    if (!journal || journal->broken) return FAILED;
+    if (journal->pending == 0) return SUCCESS;
+    if (writeFrame(journal) != SUCCESS) return FAILED;
+
+    interval = journal->checkpointInterval;
+    if (interval <= 0) interval = journal->size > RBTREE_JOURNAL_MIN_CHECKPOINT ? journal->size : RBTREE_JOURNAL_MIN_CHECKPOINT;
+    if (journal->sinceCheckpoint >= interval) return checkpointRBTreeJournal(journal);
+
+    return SUCCESS;
+}
+
+/**
+ * 写出完整的检查点并清空日志. 检查点先写入临时文件并落盘, 再原子地替换旧检查点,
+ * 任一步骤失败时旧检查点和日志保持不变
+ *
+ * @param[in]  journal: the journal
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status checkpointRBTreeJournal(RBTreeJournal *journal)
+{
+    Status status = FAILED;
+    char *temp;
+
+    if (!journal || journal->broken) return FAILED;
+    if (journal->pending > 0 && writeFrame(journal) != SUCCESS) return FAILED;
+    if (!(temp = tempName(journal->checkpointFile))) return FAILED;
+
+    if (dumpRBTree(journal->root, temp) == SUCCESS && syncPath(temp) == SUCCESS
+        && replaceFile(temp, journal->checkpointFile) == SUCCESS) {
+        if (journal->log) fclose(journal->log);
+        if ((journal->log = startLog(journal->logFile))) {
+            journal->sinceCheckpoint = 0;
+            status = SUCCESS;
+        } else journal->broken = 1;
+    }
+    free(temp);
+
+    return status;
+}
@@ -0,0 +1,94 @@
+/**
+ * @filename RBTreeMultiset.c
+ * @description Red-Black tree multiset interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 重复的键只增加结点的计数, 不插入新结点, 因此不会出现相等键组成的长链,
+ * 树高只取决于不同键的个数. insertRBTree和deleteRBTree仍按集合语义工作,
+ * 后者删除键的全部重复.
+ */
+
+#include "../HeaderFiles/RBTreeMultiset.h"
+#include "../HeaderFiles/RedBlackTreeUtils.h"
+
+#if RBTREE_MULTISET
+
+/**
+ * 多重集合中键x的个数增加delta, delta为负时减少, 个数降到0时删除结点
+ *
+ * @param[in]  root : the root of the red-black tree
+ * @param[in]  x    : the key
+ * @param[in]  delta: the change of the multiplicity, may be negative
+ * @return  the new multiplicity of x, -1 if out of memory
+ */
+int addMultiRBTree(RBRoot *root, RBTreeElemType x, int delta)
+{
+    Node *node;
+    int inserted;
+
+    if (!root) return -1;
+
+    if (delta > 0) {
+        node = insertOrFindRBTree(root, x, &inserted);
+        if (!node) return -1;
+        node->count += inserted ? delta - 1 : delta;
+    } else {
+        node = searchRBTreeNode(root, x);
+        if (!node) return 0;
+        if (node->count + delta <= 0) {
+            deleteRBTreeNode(root, node);
+            return 0;
+        }
+        node->count += delta;
+    }
+    RBTreeAugmentPath(node);
+
+    return node->count;
+}
+
+/**
+ * 多重集合插入一个键x, 已存在时计数加1
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  x   : the key
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status insertMultiRBTree(RBRoot *root, RBTreeElemType x)
+{
+    return addMultiRBTree(root, x, 1) > 0 ? SUCCESS : FAILED;
+}
+
+/**
+ * 多重集合删除一个键x, 计数减1, 降到0时删除结点
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  x   : the key
+ * @return  the operation status, SUCCESS is 0, FAILED is -1 if x is not found
+ */
+Status deleteMultiRBTree(RBRoot *root, RBTreeElemType x)
+{
+    Node *node = searchRBTreeNode(root, x);
+
+    if (!node) return FAILED;
+    if (--node->count == 0) deleteRBTreeNode(root, node);
+    else RBTreeAugmentPath(node);
+
+    return SUCCESS;
+}
+
+/**
+ * 多重集合中键x的个数, 一次O(log n)的查找
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  x   : the key
+ * @return  the multiplicity of x, 0 if not found
+ */
+int countMultiRBTree(RBRoot *root, RBTreeElemType x)
+{
+    Node *node = searchRBTreeNode(root, x);
+
+    return node ? node->count : 0;
+}
+
+#endif /* RBTREE_MULTISET */
@@ -0,0 +1,127 @@
+/**
+ * @filename RBTreeNodePool.c
+ * @description Red-Black tree node pool interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include <stdlib.h>
+#include "../HeaderFiles/RBTreeNodePool.h"
+
+static Node *poolAllocNode(void *context)
+{
+    return allocRBTreeNodePool((RBTreeNodePool *) context);
+}
+
+static void poolFreeNode(void *context, Node *node)
+{
+    freeRBTreeNodePool((RBTreeNodePool *) context, node);
+}
+
+static void poolReleaseAll(void *context)
+{
+    destroyRBTreeNodePool((RBTreeNodePool *) context);
+}
+
+/* 结点池已申请的内存块总字节数 */
+static size_t poolReservedBytes(void *context)
+{
+    RBTreeNodePool *pool = (RBTreeNodePool *) context;
+    RBTreePoolChunk *chunk;
+    size_t bytes = 0;
+
+    for (chunk = pool->chunks; chunk; chunk = chunk->next)
+        bytes += sizeof(RBTreePoolChunk) + sizeof(Node) * pool->chunkCapacity;
+
+    return bytes;
+}
+
+/**
+ * 创建结点池
+ *
+ * @param[in]  chunkCapacity: the number of nodes per chunk, <= 0 means default
+ * @return  the node pool, NULL if out of memory
+ */
+RBTreeNodePool *createRBTreeNodePool(int chunkCapacity)
+{
+    RBTreeNodePool *pool = (RBTreeNodePool *) malloc(sizeof(RBTreeNodePool));
+    if (!pool) return NULL;
+
+    pool->allocator.allocNode = poolAllocNode;
+    pool->allocator.freeNode = poolFreeNode;
+    pool->allocator.releaseAll = poolReleaseAll;
+    pool->allocator.reservedBytes = poolReservedBytes;
+    pool->allocator.context = pool;
+    pool->chunks = NULL;
+    pool->freeList = NULL;
+    pool->chunkCapacity = chunkCapacity > 0 ? chunkCapacity : RBTREE_POOL_DEFAULT_CHUNK;
+    pool->used = pool->chunkCapacity;  /* 首次分配时申请内存块 */
+
+    return pool;
+}
+
+/**
+ * 从结点池分配结点, 优先复用空闲链表中的结点
+ *
+ * @param[in]  pool: the node pool
+ * @return  the allocated node, NULL if out of memory
+ */
+Node *allocRBTreeNodePool(RBTreeNodePool *pool)
+{
+    Node *node = pool->freeList;
+
+    if (node) {
+        pool->freeList = node->right;
+        return node;
+    }
+
+    if (pool->used == pool->chunkCapacity) {
+        RBTreePoolChunk *chunk = (RBTreePoolChunk *) malloc(sizeof(RBTreePoolChunk) +
+                                                            sizeof(Node) * pool->chunkCapacity);
+        if (!chunk) return NULL;
+
+        chunk->next = pool->chunks;
+        pool->chunks = chunk;
+        pool->used = 0;
+    }
+
+    return &pool->chunks->nodes[pool->used++];
+}
+
+/**
+ * 将结点归还结点池, 挂入空闲链表
+ *
+ * @param[in]  pool: the node pool
+ * @param[in]  node: the node to be released
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status freeRBTreeNodePool(RBTreeNodePool *pool, Node *node)
+{
+    if (!pool || !node) return FAILED;
+
+    node->right = pool->freeList;
+    pool->freeList = node;
+
+    return SUCCESS;
+}
+
+/**
+ * 销毁结点池, 按内存块整体释放, 无需逐个释放结点
+ *
+ * @param[in]  pool: the node pool
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status destroyRBTreeNodePool(RBTreeNodePool *pool)
+{
+    if (!pool) return FAILED;
+
+    RBTreePoolChunk *chunk = pool->chunks;
+    while (chunk) {
+        RBTreePoolChunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(pool);
+
+    return SUCCESS;
+}
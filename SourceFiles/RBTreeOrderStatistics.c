@@ -0,0 +1,109 @@
+/**
+ * @filename RBTreeOrderStatistics.c
+ * @description Red-Black tree order statistics interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ */
+
+#include <stdio.h>
+#include "../HeaderFiles/RBTreeOrderStatistics.h"
+
+#if RBTREE_ORDER_STATISTICS
+
+/**
+ * 红黑树的结点数, 多重集合模式下为包括重复在内的键的总个数
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @return  the number of nodes
+ */
+int sizeRBTree(RBRoot *root)
+{
+    return root ? RBTreeSize(root->node) : 0;
+}
+
+/**
+ * 红黑树中数据域小于x的结点数, 即x在有序序列中的排名(从0计)
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  x   : the key to be ranked
+ * @return  the number of nodes less than x
+ */
+int rankRBTree(RBRoot *root, RBTreeElemType x)
+{
+    Node *p = root ? root->node : NULL;
+    int rank = 0;
+
+    while (p) {
+        if (p->data < x) {
+            rank += RBTreeSize(p->left) + RBTreeMultiplicity(p);
+            p = p->right;
+        } else p = p->left;
+    }
+
+    return rank;
+}
+
+/**
+ * 红黑树中第k小的结点(从0计), 多重集合模式下重复的键各占一个排名
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  k   : the rank of the target node
+ * @return  the target node, NULL if k is out of range
+ */
+RBTree selectRBTree(RBRoot *root, int k)
+{
+    Node *p = root ? root->node : NULL;
+
+    if (k < 0 || k >= RBTreeSize(p)) return NULL;
+
+    while (p) {
+        int leftSize = RBTreeSize(p->left);
+        if (k < leftSize) p = p->left;
+        else if (k >= leftSize + RBTreeMultiplicity(p)) {
+            k -= leftSize + RBTreeMultiplicity(p);
+            p = p->right;
+        } else break;
+    }
+
+    return p;
+}
+
+/**
+ * 红黑树中数据域位于[lo, hi)的结点数
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  lo  : the inclusive lower bound
+ * @param[in]  hi  : the exclusive upper bound
+ * @return  the number of nodes in range
+ */
+int countRangeRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi)
+{
+    if (lo >= hi) return 0;
+
+    return rankRBTree(root, hi) - rankRBTree(root, lo);
+}
+
+/**
+ * 红黑树的百分位数, 按最近排名法取第ceil(percent / 100 * n)小的结点
+ *
+ * @param[in]  root   : the root of the red-black tree
+ * @param[in]  percent: the percentile in [0, 100]
+ * @param[out] x      : the data of the percentile node
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status percentileRBTree(RBRoot *root, double percent, RBTreeElemType *x)
+{
+    int n = sizeRBTree(root);
+    if (n == 0 || percent < 0 || percent > 100) return FAILED;
+
+    double position = percent / 100.0 * n;
+    int k = (int) position;
+    if (k < position) k++;  /* 向上取整 */
+    if (k > 0) k--;         /* 排名从0计 */
+
+    *x = selectRBTree(root, k)->data;
+
+    return SUCCESS;
+}
+
+#endif /* RBTREE_ORDER_STATISTICS */
@@ -0,0 +1,532 @@
+/**
+ * @filename RBTreeSetOperations.c
+ * @description Red-Black tree join, split and set operations interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 以按黑高连接(join)为唯一的平衡原语, 分裂、并集、交集和差集都由它组合而成.
+ * 内部函数处理的子树根结点总是黑色且没有父结点, 并随子树一起传递其黑高,
+ * 黑高定义为从该结点(含)到任一空结点路径上的黑结点数, 空树的黑高为0.
+ * 集合运算会移动和释放结点而不分配新结点, 结束后第二棵红黑树为空.
+ * 多重集合模式下按重复次数运算: 并集相加, 交集取较小者, 差集相减后去掉不再出现的键.
+ * 区间树模式下左端点可以重复, 全部接口返回FAILED.
+ */
+
+#include <stdlib.h>
+#include "../HeaderFiles/RBTreeSetOperations.h"
+#include "../HeaderFiles/RedBlackTreeUtils.h"
+#include "../HeaderFiles/BinarySearchTree.h"
+
+#if RBTREE_PARALLEL
+#include <pthread.h>
+#endif
+
+/* 集合运算的种类 */
+typedef enum {
+    RBTREE_SET_UNION = 0,
+    RBTREE_SET_INTERSECT = 1,
+    RBTREE_SET_DIFFERENCE = 2
+} RBTreeSetOp;
+
+/* 一次集合运算的上下文 */
+typedef struct RBTreeSetContext {
+    RBTreeSetOp op;            /* 运算种类 */
+    RBRoot *a;                 /* 第一棵红黑树, 用于释放来自它的结点 */
+    RBRoot *b;                 /* 第二棵红黑树, 用于释放来自它的结点 */
+    int threads;               /* 允许使用的线程数 */
+#if RBTREE_PARALLEL
+    pthread_mutex_t lock;      /* 串行化分配器的释放操作 */
+#endif
+} RBTreeSetContext;
+
+/**
+ * 计算根结点为黑色的子树的黑高
+ *
+ * @param[in]  tree: the subtree
+ * @return  the black height
+ */
+static int blackHeight(Node *tree)
+{
+    int bh = 0;
+
+    for (; tree; tree = tree->left) bh += RBTreeIsBlack(tree);
+
+    return bh;
+}
+
+/**
+ * 由结点的黑高向上累加祖先中的黑结点数, 得到整棵树的黑高
+ *
+ * @param[in]  node: the node
+ * @param[in]  bh  : the black height of the node
+ * @return  the black height of the whole tree
+ */
+static int blackHeightAbove(Node *node, int bh)
+{
+    for (node = RBTreeParent(node); node; node = RBTreeParent(node)) bh += RBTreeIsBlack(node);
+
+    return bh;
+}
+
+/**
+ * 把子树从父结点摘下作为独立的红黑树, 根结点为红色时涂黑并增加黑高
+ *
+ * @param[in]  tree: the subtree
+ * @param[in]  bh  : the black height of the subtree
+ * @return  the detached subtree
+ */
+static Node *detachSubtree(Node *tree, int *bh)
+{
+    if (tree) {
+        RBTreeSetParent(tree, NULL);
+        if (RBTreeIsRed(tree)) {
+            RBTreeSetBlack(tree);
+            (*bh)++;
+        }
+    }
+
+    return tree;
+}
+
+/**
+ * 按黑高连接: left的所有键 < key < right的所有键, 时间为O(|leftBh - rightBh| + 1)
+ *
+ * @param[in]  owner  : the tree whose counters receive the rebalancing work
+ * @param[in]  left   : the left tree
+ * @param[in]  leftBh : the black height of left
+ * @param[in]  key    : the node to join with
+ * @param[in]  right  : the right tree
+ * @param[in]  rightBh: the black height of right
+ * @param[out] bh     : the black height of the joined tree
+ * @return  the joined tree
+ */
+static Node *joinSubtrees(RBRoot *owner, Node *left, int leftBh, Node *key, Node *right, int rightBh, int *bh)
+{
+    RBRoot scratch = {0};
+    Node *parent = NULL, *c;
+    int h;
+
+    if (leftBh == rightBh) {
+        key->left = left;
+        key->right = right;
+        if (left) RBTreeSetParent(left, key);
+        if (right) RBTreeSetParent(right, key);
+        RBTreeSetParentColor(key, NULL, BLACK);
+        RBTreeAugmentNode(key);
+        *bh = leftBh + 1;
+        return key;
+    }
+
+    if (leftBh > rightBh) {
+        /* 沿left的右脊下降到黑高为rightBh的黑结点c, 以红色的key替换c */
+        for (c = left, h = leftBh; h > rightBh || (c && RBTreeIsRed(c)); c = c->right) {
+            h -= RBTreeIsBlack(c);
+            parent = c;
+        }
+        key->left = c;
+        key->right = right;
+        parent->right = key;
+        scratch.node = left;
+    } else {
+        for (c = right, h = rightBh; h > leftBh || (c && RBTreeIsRed(c)); c = c->left) {
+            h -= RBTreeIsBlack(c);
+            parent = c;
+        }
+        key->left = left;
+        key->right = c;
+        parent->left = key;
+        scratch.node = right;
+    }
+    if (key->left) RBTreeSetParent(key->left, key);
+    if (key->right) RBTreeSetParent(key->right, key);
+    RBTreeSetParentColor(key, parent, RED);
+    RBTreeAugmentPath(key);
+    RBTreeInsertSelfBalancing(&scratch, key);
+#if RBTREE_STATS
+    /* 自平衡的计数记在临时根结点上, 累加回owner; 并行的子问题可能同时累加 */
+    RBTreeCountShared(owner, rotations, scratch.counters.rotations);
+    RBTreeCountShared(owner, recolors, scratch.counters.recolors);
+    RBTreeCountShared(owner, insertFixups, scratch.counters.insertFixups);
+#else
+    (void) owner;
+#endif
+
+    /* 自平衡不改变较矮一侧子树的内部, 由它向上累加得到新的黑高;
+     * 较矮一侧为空时key是最大(最小)结点, 没有右(左)孩子 */
+    if (leftBh > rightBh) *bh = right ? blackHeightAbove(right, rightBh) : blackHeightAbove(key, RBTreeIsBlack(key));
+    else *bh = left ? blackHeightAbove(left, leftBh) : blackHeightAbove(key, RBTreeIsBlack(key));
+
+    return scratch.node;
+}
+
+/**
+ * 摘下子树的最大结点, 其余结点重新连接成红黑树
+ *
+ * @param[in]  owner : the tree whose counters receive the rebalancing work
+ * @param[in]  tree  : the non-empty tree
+ * @param[in]  bh    : the black height of tree
+ * @param[out] last  : the maximum node
+ * @param[out] restBh: the black height of the rest
+ * @return  the rest of the tree
+ */
+static Node *splitLast(RBRoot *owner, Node *tree, int bh, Node **last, int *restBh)
+{
+    Node *left = tree->left, *right = tree->right, *rest;
+    int leftBh = bh - RBTreeIsBlack(tree), rightBh = leftBh;
+
+    left = detachSubtree(left, &leftBh);
+    if (!right) {
+        *last = tree;
+        *restBh = leftBh;
+        return left;
+    }
+    right = detachSubtree(right, &rightBh);
+    rest = splitLast(owner, right, rightBh, last, &rightBh);
+
+    return joinSubtrees(owner, left, leftBh, tree, rest, rightBh, restBh);
+}
+
+/**
+ * 不带中间结点的连接: left的所有键 < right的所有键
+ *
+ * @param[in]  owner  : the tree whose counters receive the rebalancing work
+ * @param[in]  left   : the left tree
+ * @param[in]  leftBh : the black height of left
+ * @param[in]  right  : the right tree
+ * @param[in]  rightBh: the black height of right
+ * @param[out] bh     : the black height of the joined tree
+ * @return  the joined tree
+ */
+static Node *concatSubtrees(RBRoot *owner, Node *left, int leftBh, Node *right, int rightBh, int *bh)
+{
+    Node *last;
+
+    if (!left) {
+        *bh = rightBh;
+        return right;
+    }
+    if (!right) {
+        *bh = leftBh;
+        return left;
+    }
+    left = splitLast(owner, left, leftBh, &last, &leftBh);
+
+    return joinSubtrees(owner, left, leftBh, last, right, rightBh, bh);
+}
+
+/**
+ * 按x分裂子树为小于x和大于x的两棵红黑树, 等于x的结点单独返回
+ *
+ * @param[in]  owner    : the tree whose counters receive the rebalancing work
+ * @param[in]  tree     : the tree
+ * @param[in]  bh       : the black height of tree
+ * @param[in]  x        : the key to split at
+ * @param[out] less     : the tree of keys less than x
+ * @param[out] lessBh   : the black height of less
+ * @param[out] found    : the node equal to x, NULL if not exists
+ * @param[out] greater  : the tree of keys greater than x
+ * @param[out] greaterBh: the black height of greater
+ * @return  none
+ */
+static void splitSubtree(RBRoot *owner, Node *tree, int bh, RBTreeElemType x, Node **less, int *lessBh,
+                         Node **found, Node **greater, int *greaterBh)
+{
+    Node *left, *right, *part;
+    int leftBh, rightBh, partBh;
+
+    if (!tree) {
+        *less = *greater = *found = NULL;
+        *lessBh = *greaterBh = 0;
+        return;
+    }
+
+    leftBh = rightBh = bh - RBTreeIsBlack(tree);
+    left = detachSubtree(tree->left, &leftBh);
+    right = detachSubtree(tree->right, &rightBh);
+
+    if (x == tree->data) {
+        *less = left;
+        *lessBh = leftBh;
+        *found = tree;
+        *greater = right;
+        *greaterBh = rightBh;
+    } else if (x < tree->data) {
+        splitSubtree(owner, left, leftBh, x, less, lessBh, found, &part, &partBh);
+        *greater = joinSubtrees(owner, part, partBh, tree, right, rightBh, greaterBh);
+    } else {
+        splitSubtree(owner, right, rightBh, x, &part, &partBh, found, greater, greaterBh);
+        *less = joinSubtrees(owner, left, leftBh, tree, part, partBh, lessBh);
+    }
+}
+
+/**
+ * 释放来自owner的子树, 并行时与其他线程的释放互斥
+ *
+ * @param[in]  ctx  : the set operation context
+ * @param[in]  owner: the tree the nodes come from
+ * @param[in]  tree : the subtree or single node to release
+ * @param[in]  whole: 1 to release the whole subtree, 0 to release the node only
+ * @return  none
+ */
+static void releaseNodes(RBTreeSetContext *ctx, RBRoot *owner, Node *tree, int whole)
+{
+    if (!tree) return;
+
+#if RBTREE_PARALLEL
+    if (ctx->threads > 1) pthread_mutex_lock(&ctx->lock);
+#else
+    (void) ctx;
+#endif
+    if (whole) destroyRBTreeNodes(owner, tree);
+    else freeRBTreeNode(owner, tree);
+#if RBTREE_PARALLEL
+    if (ctx->threads > 1) pthread_mutex_unlock(&ctx->lock);
+#endif
+}
+
+static Node *setOperation(RBTreeSetContext *ctx, Node *a, int aBh, Node *b, int bBh, int threads, int *bh);
+
+#if RBTREE_PARALLEL
+/* 分派给新线程的子问题 */
+typedef struct RBTreeSetTask {
+    RBTreeSetContext *ctx;
+    Node *a, *b, *result;
+    int aBh, bBh, threads, resultBh;
+} RBTreeSetTask;
+
+static void *setOperationTask(void *arg)
+{
+    RBTreeSetTask *task = (RBTreeSetTask *) arg;
+    task->result = setOperation(task->ctx, task->a, task->aBh, task->b, task->bBh, task->threads, &task->resultBh);
+
+    return NULL;
+}
+#endif
+
+/**
+ * 分治的集合运算: 以b的根结点分裂a, 两侧子问题递归求解后再连接
+ *
+ * @param[in]  ctx    : the set operation context
+ * @param[in]  a      : the subtree from the first tree
+ * @param[in]  aBh    : the black height of a
+ * @param[in]  b      : the subtree from the second tree
+ * @param[in]  bBh    : the black height of b
+ * @param[in]  threads: the number of threads this subproblem may use, including the calling thread
+ * @param[out] bh     : the black height of the result
+ * @return  the result tree
+ */
+static Node *setOperation(RBTreeSetContext *ctx, Node *a, int aBh, Node *b, int bBh, int threads, int *bh)
+{
+    Node *less, *found, *greater, *bl, *br, *left, *right;
+    int lessBh, greaterBh, blBh, brBh, leftBh, rightBh;
+
+    if (!a || !b) {
+        if (ctx->op == RBTREE_SET_UNION) {
+            *bh = a ? aBh : bBh;
+            return a ? a : b;
+        }
+        releaseNodes(ctx, ctx->b, b, 1);
+        if (ctx->op == RBTREE_SET_DIFFERENCE) {
+            *bh = aBh;
+            return a;
+        }
+        releaseNodes(ctx, ctx->a, a, 1);
+        *bh = 0;
+        return NULL;
+    }
+
+    splitSubtree(ctx->a, a, aBh, b->data, &less, &lessBh, &found, &greater, &greaterBh);
+    blBh = brBh = bBh - RBTreeIsBlack(b);
+    bl = detachSubtree(b->left, &blBh);
+    br = detachSubtree(b->right, &brBh);
+
+    /* 两侧子问题互不相交, 可以并行求解: 新线程分得一半线程数, 当前线程保留其余, 总线程数不超过请求值 */
+#if RBTREE_PARALLEL
+    if (threads > 1 && bBh >= RBTREE_PARALLEL_MIN_HEIGHT) {
+        RBTreeSetTask task = {ctx, less, bl, NULL, lessBh, blBh, threads / 2, 0};
+        pthread_t thread;
+
+        if (!pthread_create(&thread, NULL, setOperationTask, &task)) {
+            right = setOperation(ctx, greater, greaterBh, br, brBh, threads - threads / 2, &rightBh);
+            pthread_join(thread, NULL);
+            left = task.result;
+            leftBh = task.resultBh;
+        } else {
+            left = setOperation(ctx, less, lessBh, bl, blBh, 1, &leftBh);
+            right = setOperation(ctx, greater, greaterBh, br, brBh, 1, &rightBh);
+        }
+    } else
+#endif
+    {
+        left = setOperation(ctx, less, lessBh, bl, blBh, threads, &leftBh);
+        right = setOperation(ctx, greater, greaterBh, br, brBh, threads, &rightBh);
+    }
+
+    switch (ctx->op) {
+        case RBTREE_SET_UNION:
+            /* 重复的键保留b的结点 */
+#if RBTREE_MULTISET
+            if (found) b->count += found->count;
+#endif
+            releaseNodes(ctx, ctx->a, found, 0);
+            return joinSubtrees(ctx->a, left, leftBh, b, right, rightBh, bh);
+        case RBTREE_SET_INTERSECT:
+#if RBTREE_MULTISET
+            if (found && b->count < found->count) found->count = b->count;
+#endif
+            releaseNodes(ctx, ctx->b, b, 0);
+            if (found) return joinSubtrees(ctx->a, left, leftBh, found, right, rightBh, bh);
+            return concatSubtrees(ctx->a, left, leftBh, right, rightBh, bh);
+        default:
+#if RBTREE_MULTISET
+            if (found && found->count > b->count) {
+                found->count -= b->count;
+                releaseNodes(ctx, ctx->b, b, 0);
+                return joinSubtrees(ctx->a, left, leftBh, found, right, rightBh, bh);
+            }
+#endif
+            releaseNodes(ctx, ctx->b, b, 0);
+            releaseNodes(ctx, ctx->a, found, 0);
+            return concatSubtrees(ctx->a, left, leftBh, right, rightBh, bh);
+    }
+}
+
+/**
+ * 执行集合运算, 结果存入a, b被清空
+ *
+ * @param[in]  a      : the first red-black tree
+ * @param[in]  b      : the second red-black tree
+ * @param[in]  op     : the set operation
+ * @param[in]  threads: the maximum number of threads
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+static Status runSetOperation(RBRoot *a, RBRoot *b, RBTreeSetOp op, int threads)
+{
+    RBTreeSetContext ctx;
+    int bh;
+
+    /* 区间树的左端点可以重复, 集合运算要求键互不相同 */
+    if (RBTREE_INTERVAL || !a || !b || a == b) return FAILED;
+
+    ctx.op = op;
+    ctx.a = a;
+    ctx.b = b;
+#if RBTREE_PARALLEL
+    ctx.threads = threads > 1 ? threads : 1;
+    if (ctx.threads > 1) pthread_mutex_init(&ctx.lock, NULL);
+#else
+    (void) threads;
+    ctx.threads = 1;
+#endif
+
+    a->node = setOperation(&ctx, a->node, blackHeight(a->node), b->node, blackHeight(b->node), ctx.threads, &bh);
+    a->rightmost = maxBinarySearchTreeNode(a->node);
+    b->node = NULL;
+    b->rightmost = NULL;
+
+#if RBTREE_PARALLEL
+    if (ctx.threads > 1) pthread_mutex_destroy(&ctx.lock);
+#endif
+
+    return SUCCESS;
+}
+
+/**
+ * 以x连接两棵红黑树, 要求left的所有键 < x < right的所有键.
+ * 结果存入left, right被清空, 两棵树必须使用同一个分配器
+ *
+ * @param[in]  left : the left red-black tree
+ * @param[in]  x    : the key between the two trees
+ * @param[in]  right: the right red-black tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status joinRBTree(RBRoot *left, RBTreeElemType x, RBRoot *right)
+{
+    Node *key;
+    int bh;
+
+    if (RBTREE_INTERVAL || !left || !right || left == right || left->allocator != right->allocator) return FAILED;
+    if (left->node && maxBinarySearchTreeNode(left->node)->data >= x) return FAILED;
+    if (right->node && minBinarySearchTreeNode(right->node)->data <= x) return FAILED;
+
+    key = createRBTreeNode(left, x, NULL, NULL, NULL);
+    if (!key) return FAILED;
+
+    left->node = joinSubtrees(left, left->node, blackHeight(left->node), key, right->node, blackHeight(right->node),
+                              &bh);
+    left->rightmost = right->node ? right->rightmost : key;
+    right->node = NULL;
+    right->rightmost = NULL;
+
+    return SUCCESS;
+}
+
+/**
+ * 按x分裂红黑树, 小于x的键留在root中, 不小于x的键移入greater.
+ * greater必须为空, 且与root使用同一个分配器
+ *
+ * @param[in]  root   : the red-black tree
+ * @param[in]  x      : the key to split at
+ * @param[in]  greater: the empty red-black tree receiving keys not less than x
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status splitRBTree(RBRoot *root, RBTreeElemType x, RBRoot *greater)
+{
+    Node *less, *found, *more;
+    int lessBh, moreBh;
+
+    if (RBTREE_INTERVAL || !root || !greater || root == greater || greater->node) return FAILED;
+    if (root->allocator != greater->allocator) return FAILED;
+
+    splitSubtree(root, root->node, blackHeight(root->node), x, &less, &lessBh, &found, &more, &moreBh);
+    if (found) more = joinSubtrees(root, NULL, 0, found, more, moreBh, &moreBh);
+
+    greater->rightmost = more ? root->rightmost : NULL;
+    root->node = less;
+    root->rightmost = maxBinarySearchTreeNode(less);
+    greater->node = more;
+
+    return SUCCESS;
+}
+
+/**
+ * 红黑树的并集, 结果存入a, b被清空, 两棵树必须使用同一个分配器.
+ * 设两棵树大小为m <= n, 工作量为O(m log(n / m + 1))
+ *
+ * @param[in]  a      : the first red-black tree
+ * @param[in]  b      : the second red-black tree
+ * @param[in]  threads: the maximum number of threads, effective with RBTREE_PARALLEL
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status unionRBTree(RBRoot *a, RBRoot *b, int threads)
+{
+    if (!a || !b || a->allocator != b->allocator) return FAILED;
+
+    return runSetOperation(a, b, RBTREE_SET_UNION, threads);
+}
+
+/**
+ * 红黑树的交集, 结果存入a, b被清空
+ *
+ * @param[in]  a      : the first red-black tree
+ * @param[in]  b      : the second red-black tree
+ * @param[in]  threads: the maximum number of threads, effective with RBTREE_PARALLEL
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status intersectRBTree(RBRoot *a, RBRoot *b, int threads)
+{
+    return runSetOperation(a, b, RBTREE_SET_INTERSECT, threads);
+}
+
+/**
+ * 红黑树的差集a - b, 结果存入a, b被清空
+ *
+ * @param[in]  a      : the first red-black tree
+ * @param[in]  b      : the second red-black tree
+ * @param[in]  threads: the maximum number of threads, effective with RBTREE_PARALLEL
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status differenceRBTree(RBRoot *a, RBRoot *b, int threads)
+{
+    return runSetOperation(a, b, RBTREE_SET_DIFFERENCE, threads);
+}
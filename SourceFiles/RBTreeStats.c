@@ -0,0 +1,82 @@
+/**
+ * @filename RBTreeStats.c
+ * @description Red-Black tree statistics interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 操作计数器只在RBTREE_STATS开启时维护, 关闭时各计数点展开为空语句, 不增加任何开销.
+ * 结点数, 高度, 黑高和内存占用在查询时遍历红黑树得到, 不依赖编译选项.
+ */
+
+#include <string.h>
+#include "../HeaderFiles/RBTreeStats.h"
+
+/**
+ * 获取红黑树的统计信息, 沿父结点指针遍历全部结点, 不使用递归
+ *
+ * @param[in]  root : the root of the red-black tree
+ * @param[out] stats: the statistics
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status getRBTreeStats(RBRoot *root, RBTreeStats *stats)
+{
+    Node *prev = NULL, *p;
+    int depth = 0;
+
+    if (!root || !stats) return FAILED;
+
+    memset(stats, 0, sizeof(RBTreeStats));
+#if RBTREE_STATS
+    stats->counters = root->counters;
+#endif
+
+    for (p = root->node; p; p = p->left) stats->blackHeight += RBTreeIsBlack(p);
+
+    p = root->node;
+    while (p) {
+        if (prev == RBTreeParent(p)) {  /* 从父结点下降而来 */
+            stats->nodes++;
+            if (++depth > stats->height) stats->height = depth;
+            prev = p;
+            if (p->left) p = p->left;
+            else if (p->right) p = p->right;
+            else {
+                p = RBTreeParent(p);
+                depth--;
+            }
+        } else if (prev == p->left && p->right) {  /* 从左子树返回, 进入右子树 */
+            prev = p;
+            p = p->right;
+        } else {  /* 左右子树均已遍历 */
+            prev = p;
+            p = RBTreeParent(p);
+            depth--;
+        }
+    }
+
+    stats->liveBytes = sizeof(Node) * (size_t) stats->nodes;
+    stats->reservedBytes = stats->liveBytes;
+    if (root->allocator && root->allocator->reservedBytes)
+        stats->reservedBytes = root->allocator->reservedBytes(root->allocator->context);
+    if (stats->reservedBytes > stats->liveBytes)
+        stats->fragmentation = 1.0 - (double) stats->liveBytes / (double) stats->reservedBytes;
+
+    return SUCCESS;
+}
+
+/**
+ * 清零红黑树的操作计数器, 未启用RBTREE_STATS时为空操作
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status resetRBTreeStats(RBRoot *root)
+{
+    if (!root) return FAILED;
+
+#if RBTREE_STATS
+    memset(&root->counters, 0, sizeof(root->counters));
+#endif
+
+    return SUCCESS;
+}
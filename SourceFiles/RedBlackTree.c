@@ -7,10 +7,12 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "../HeaderFiles/RedBlackTree.h"
 #include "../HeaderFiles/RedBlackTreeUtils.h"
 #include "../HeaderFiles/BinarySearchTree.h"
 #include "../HeaderFiles/BinaryTree.h"
+#include "../HeaderFiles/RBTreeNodePool.h"
 
 /**
  * 创建红黑树
@@ -22,10 +24,206 @@ RBRoot *createRBTree()
 {
     RBRoot *root = (RBRoot *) malloc(sizeof(RBRoot));
     root->node = NULL;
+    root->allocator = NULL;
+    root->rightmost = NULL;
+#if RBTREE_STATS
+    memset(&root->counters, 0, sizeof(root->counters));
+#endif
 
     return root;
 }
 
+/**
+ * 创建使用结点池分配结点的红黑树, 结点池随红黑树一同销毁
+ *
+ * @param[in]  chunkCapacity: the number of nodes per pool chunk, <= 0 means default
+ * @return  the root of the red-black tree
+ */
+RBRoot *createPooledRBTree(int chunkCapacity)
+{
+    RBTreeNodePool *pool = createRBTreeNodePool(chunkCapacity);
+    if (!pool) return NULL;
+
+    RBRoot *root = createRBTree();
+    if (!root) {
+        destroyRBTreeNodePool(pool);
+        return NULL;
+    }
+    root->allocator = &pool->allocator;
+
+    return root;
+}
+
+/**
+ * 设置红黑树的结点分配器, 只能在红黑树为空时设置
+ *
+ * @param[in]  root     : the root of the red-black tree
+ * @param[in]  allocator: the node allocator, NULL means malloc/free
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status setRBTreeAllocator(RBRoot *root, RBTreeAllocator *allocator)
+{
+    if (!root || root->node) return FAILED;
+
+    root->allocator = allocator;
+
+    return SUCCESS;
+}
+
+/**
+ * 由严格递增的数组keys[lo, hi)递归构建平衡子树, 深度为redDepth的结点着红色
+ *
+ * @param[in]  root    : the root of the red-black tree
+ * @param[in]  keys    : the strictly increasing keys
+ * @param[in]  counts  : the multiplicity of each key, NULL means all 1
+ * @param[in]  lo      : the first index of the subtree
+ * @param[in]  hi      : one past the last index of the subtree
+ * @param[in]  depth   : the depth of the subtree root
+ * @param[in]  redDepth: the depth of the incomplete bottom level
+ * @param[in]  parent  : the parent of the subtree root
+ * @return  the subtree root, NULL if empty or out of memory
+ */
+static RBTree buildSortedSubtree(RBRoot *root, const RBTreeElemType *keys, const int *counts, int lo, int hi,
+                                 int depth, int redDepth, Node *parent)
+{
+    if (lo >= hi) return NULL;
+
+    int mid = lo + (hi - lo) / 2;
+    Node *node = createRBTreeNode(root, keys[mid], parent, NULL, NULL);
+    if (!node) return NULL;
+
+#if RBTREE_MULTISET
+    if (counts) node->count = counts[mid];
+#else
+    (void) counts;
+#endif
+    if (depth == redDepth) RBTreeSetRed(node);
+    node->left = buildSortedSubtree(root, keys, counts, lo, mid, depth + 1, redDepth, node);
+    node->right = buildSortedSubtree(root, keys, counts, mid + 1, hi, depth + 1, redDepth, node);
+    RBTreeAugmentNode(node);
+
+    /* 孩子结点分配失败时释放整棵子树 */
+    if ((lo < mid && !node->left) || (mid + 1 < hi && !node->right)) {
+        destroyRBTreeNodes(root, node);
+        return NULL;
+    }
+
+    return node;
+}
+
+/**
+ * 由非递减数组线性时间构建红黑树, 红黑树必须为空.
+ * 重复的键只保留一个结点, 多重集合模式下结点的计数为键的重复次数
+ *
+ * 按中点划分得到的二叉树各叶子深度至多相差1, 将最底层不满的一层着红色,
+ * 其余结点着黑色, 即满足红黑树的性质, 无需逐个插入和自平衡.
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  keys: the non-decreasing keys
+ * @param[in]  n   : the number of keys
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status buildRBTreeFromSorted(RBRoot *root, const RBTreeElemType *keys, int n)
+{
+    RBTreeElemType *unique;
+    int *counts = NULL;
+    int i, count = n;
+    Status status;
+
+    if (!root || root->node || n < 0 || (n > 0 && !keys)) return FAILED;
+
+    for (i = 1; i < n; i++) {
+        if (keys[i] < keys[i - 1]) return FAILED;
+        if (keys[i] == keys[i - 1]) count--;
+    }
+    if (count == n) return buildRBTreeFromCounts(root, keys, NULL, n);
+
+    /* 存在重复的键时先去重 */
+    unique = (RBTreeElemType *) malloc(sizeof(RBTreeElemType) * count);
+    if (!unique) return FAILED;
+#if RBTREE_MULTISET
+    counts = (int *) malloc(sizeof(int) * count);
+    if (!counts) {
+        free(unique);
+        return FAILED;
+    }
+#endif
+    count = 0;
+    for (i = 0; i < n; i++) {
+        if (i == 0 || keys[i] != keys[i - 1]) {
+            if (counts) counts[count] = 0;
+            unique[count++] = keys[i];
+        }
+        if (counts) counts[count - 1]++;
+    }
+
+    status = buildRBTreeFromCounts(root, unique, counts, count);
+    free(unique);
+    free(counts);
+
+    return status;
+}
+
+/**
+ * 由严格递增的键及其个数线性时间构建红黑树, 红黑树必须为空.
+ * 多重集合模式下结点的计数为对应的个数, 否则个数被忽略
+ *
+ * @param[in]  root  : the root of the red-black tree
+ * @param[in]  keys  : the strictly increasing keys
+ * @param[in]  counts: the multiplicity of each key, each at least 1, NULL means all 1
+ * @param[in]  n     : the number of keys
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status buildRBTreeFromCounts(RBRoot *root, const RBTreeElemType *keys, const int *counts, int n)
+{
+    int i, redDepth = 0;
+
+    if (!root || root->node || n < 0 || (n > 0 && !keys)) return FAILED;
+    for (i = 0; i < n; i++) {
+        if ((i > 0 && keys[i] <= keys[i - 1]) || (counts && counts[i] < 1)) return FAILED;
+    }
+
+    /* 前redDepth层是满的, 第redDepth层(从0计)不满时着红色 */
+    while ((2LL << redDepth) - 1 <= n) redDepth++;
+
+    RBTreeStoreLink(root->node, buildSortedSubtree(root, keys, counts, 0, n, 0, redDepth, NULL));
+    root->rightmost = maxBinarySearchTreeNode(root->node);
+
+    return n == 0 || root->node ? SUCCESS : FAILED;
+}
+
+static int compareElem(const void *a, const void *b)
+{
+    RBTreeElemType x = *(const RBTreeElemType *) a, y = *(const RBTreeElemType *) b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * 由任意顺序的数组构建红黑树, 先排序再线性构建, 红黑树必须为空
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  keys: the keys in any order
+ * @param[in]  n   : the number of keys
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status buildRBTree(RBRoot *root, const RBTreeElemType *keys, int n)
+{
+    if (!root || root->node || n < 0 || (n > 0 && !keys)) return FAILED;
+    if (n == 0) return SUCCESS;
+
+    RBTreeElemType *sorted = (RBTreeElemType *) malloc(sizeof(RBTreeElemType) * n);
+    if (!sorted) return FAILED;
+
+    memcpy(sorted, keys, sizeof(RBTreeElemType) * n);
+    qsort(sorted, n, sizeof(RBTreeElemType), compareElem);
+
+    Status status = buildRBTreeFromSorted(root, sorted, n);
+    free(sorted);
+
+    return status;
+}
+
 /**
  * 销毁红黑树
  *
@@ -35,7 +233,10 @@ RBRoot *createRBTree()
 Status destroyRBTree(RBRoot *root)
 {
     if (!root) return FAILED;
-    else destroyBinaryTree(root->node);
+
+    if (!root->allocator) destroyBinaryTree(root->node);
+    else if (root->allocator->releaseAll) root->allocator->releaseAll(root->allocator->context);
+    else destroyRBTreeNodes(root, root->node);
 
     free(root);
 
@@ -84,6 +285,23 @@ Status postorderRBTree(RBRoot *root)
     return SUCCESS;
 }
 
+/**
+ * 以回调方式遍历红黑树, 遍历过程中不输出任何内容
+ *
+ * @param[in]  root : the root of the red-black tree
+ * @param[in]  order: RBTREE_PREORDER, RBTREE_INORDER or RBTREE_POSTORDER
+ * @param[in]  visit: the callback applied to each node, non-zero stops the traversal
+ * @param[in]  arg  : the argument passed to visit
+ * @return  SUCCESS if all nodes are visited, FAILED if stopped by visit
+ */
+Status visitRBTree(RBRoot *root, RBTreeOrder order, RBTreeVisitFunc visit, void *arg)
+{
+    if (!root || !visit) return FAILED;
+    if (!root->node) return SUCCESS;
+
+    return visitBiTree(root->node, order, visit, arg);
+}
+
 /**
  * 递归查找红黑树tree中数据域为x的结点
  *
@@ -93,7 +311,105 @@ Status postorderRBTree(RBRoot *root)
  */
 Status recursiveSearchRBTree(RBRoot *root, RBTreeElemType x)
 {
-    if (root) return recursiveSearchNode(root->node, x) ? SUCCESS : FAILED;
+    return searchRBTreeNode(root, x) ? SUCCESS : FAILED;
+}
+
+/**
+ * 查找红黑树中数据域为x的结点
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  x   : the data of the node
+ * @return  the target node, NULL if not found
+ */
+RBTree searchRBTreeNode(RBRoot *root, RBTreeElemType x)
+{
+#if RBTREE_STATS
+    Node *p;
+    unsigned long long visited = 0;
+
+    if (!root) return NULL;
+    for (p = RBTreeLoadLink(root->node); p && (visited++, p->data != x);)
+        p = x < p->data ? RBTreeLoadLink(p->left) : RBTreeLoadLink(p->right);
+    RBTreeCountShared(root, searches, 1);
+    RBTreeCountShared(root, comparisons, visited);
+
+    return p;
+#else
+    return root ? searchBiTreeNode(root->node, x) : NULL;
+#endif
+}
+
+/**
+ * 红黑树查找第一个数据域不小于x的结点
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  x   : the lower bound
+ * @return  the target node, NULL if all nodes are less than x
+ */
+RBTree lowerBoundRBTree(RBRoot *root, RBTreeElemType x)
+{
+    return root ? BSTreeLowerBound(root->node, x) : NULL;
+}
+
+/**
+ * 红黑树查找第一个数据域大于x的结点
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  x   : the upper bound
+ * @return  the target node, NULL if no node is greater than x
+ */
+RBTree upperBoundRBTree(RBRoot *root, RBTreeElemType x)
+{
+    return root ? BSTreeUpperBound(root->node, x) : NULL;
+}
+
+/**
+ * 按从小到大的顺序遍历红黑树中数据域位于[lo, hi)的结点
+ *
+ * @param[in]  root : the root of the red-black tree
+ * @param[in]  lo   : the inclusive lower bound
+ * @param[in]  hi   : the exclusive upper bound
+ * @param[in]  visit: the callback applied to each node, non-zero stops the scan
+ * @param[in]  arg  : the argument passed to visit
+ * @return  SUCCESS if the whole range is visited, FAILED if stopped by visit
+ */
+Status rangeRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi, RBTreeVisitFunc visit, void *arg)
+{
+    if (!root || !visit) return FAILED;
+
+    for (Node *p = BSTreeLowerBound(root->node, lo); p && p->data < hi; p = BSTreeSuccessor(p)) {
+        if (visit(p, arg)) return FAILED;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * 红黑树删除数据域位于[lo, hi)的全部结点
+ *
+ * 只查找一次下界, 之后沿后继结点逐个删除. 删除时替代结点被移动而非复制数据,
+ * 所以事先取得的后继结点指针始终有效, 总代价为O(log n + k).
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  lo  : the inclusive lower bound
+ * @param[in]  hi  : the exclusive upper bound
+ * @return  the number of deleted nodes
+ */
+int eraseRangeRBTree(RBRoot *root, RBTreeElemType lo, RBTreeElemType hi)
+{
+    int count = 0;
+
+    if (!root) return 0;
+
+    Node *p = BSTreeLowerBound(root->node, lo);
+    while (p && p->data < hi) {
+        Node *next = BSTreeSuccessor(p);
+        deleteRBTreeNode(root, p);
+        count++;
+        p = next;
+    }
+
+    return count;
 }
 
 /**
@@ -105,18 +421,210 @@ Status recursiveSearchRBTree(RBRoot *root, RBTreeElemType x)
  */
 Status insertRBTree(RBRoot *root, RBTreeElemType x)
 {
-    if (recursiveSearchNode(root->node, x)) return FAILED;
+    int inserted;
 
-    Node *node;
-    node = createRBTreeNode(x, NULL, NULL, NULL);
-    if (!node) return FAILED;
+    if (!insertOrFindRBTree(root, x, &inserted)) return FAILED;
+
+    return inserted ? SUCCESS : FAILED;
+}
+
+/**
+ * 红黑树单次下降查找数据域为x的结点, 不存在时插入该结点
+ *
+ * @param[in]  root    : the root of the red-black tree
+ * @param[in]  x       : the data of the node
+ * @param[out] inserted: 1 if the node is newly inserted, 0 if it already exists
+ * @return  the existing or inserted node, NULL if out of memory
+ */
+RBTree insertOrFindRBTree(RBRoot *root, RBTreeElemType x, int *inserted)
+{
+    return insertHintRBTree(root, NULL, x, inserted);
+}
 
-    insertBinarySearchTree(root, node);
+/**
+ * 红黑树从提示结点出发查找数据域为x的结点, 先沿父结点指针回溯到可能包含x的子树再下降.
+ * x与提示结点越接近代价越小, 远离时不超过一次完整下降的两倍
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  hint: a node of the tree near x, such as the last visited node, NULL means the root
+ * @param[in]  x   : the data of the node
+ * @return  the target node, NULL if not found
+ */
+RBTree searchHintRBTree(RBRoot *root, Node *hint, RBTreeElemType x)
+{
+    Node *parent;
+
+    if (!root || (root->rightmost && x > root->rightmost->data)) return NULL;
+
+    return searchInsertPosition(root, hint ? BSTreeFingerAncestor(hint, x) : root->node, x, &parent);
+}
+
+/**
+ * 红黑树交错地批量查找多个键. 同时推进RBTREE_SEARCH_BATCH_WIDTH个查找, 每个查找每轮只下降一层
+ * 并预取下一层的结点, 轮到它时结点已在缓存中; 某个查找结束后立即由下一个键接替,
+ * 使各查找的缓存缺失相互重叠而不是依次等待
+ *
+ * @param[in]  root   : the root of the red-black tree
+ * @param[in]  keys   : the keys to search, in any order
+ * @param[in]  n      : the number of keys
+ * @param[out] results: results[i] is the node of keys[i], NULL if not found, may be NULL
+ * @return  the number of keys found
+ */
+int searchBatchRBTree(RBRoot *root, const RBTreeElemType *keys, int n, Node **results)
+{
+    Node *lane[RBTREE_SEARCH_BATCH_WIDTH];
+    int index[RBTREE_SEARCH_BATCH_WIDTH];
+    int active = 0, next = 0, found = 0, i;
+#if RBTREE_STATS
+    unsigned long long visited = 0;
+#endif
+
+    if (!root || !keys) return 0;
+
+    for (i = 0; i < RBTREE_SEARCH_BATCH_WIDTH; i++) {
+        index[i] = next < n ? next++ : -1;
+        lane[i] = RBTreeLoadLink(root->node);
+        if (index[i] >= 0) active++;
+    }
+
+    while (active) {
+        for (i = 0; i < RBTREE_SEARCH_BATCH_WIDTH; i++) {
+            Node *p = lane[i];
+            RBTreeElemType x;
+
+            if (index[i] < 0) continue;
+            x = keys[index[i]];
+#if RBTREE_STATS
+            if (p) visited++;
+#endif
+            if (p && p->data != x) {
+                p = x < p->data ? RBTreeLoadLink(p->left) : RBTreeLoadLink(p->right);
+                lane[i] = p;
+                if (p) {
+                    RBTreePrefetch(p);
+                    continue;
+                }
+            }
+
+            /* 该查找结束, p为目标结点或NULL, 由下一个键接替 */
+            if (results) results[index[i]] = p;
+            if (p) found++;
+            if (next < n) {
+                index[i] = next++;
+                lane[i] = RBTreeLoadLink(root->node);
+            } else {
+                index[i] = -1;
+                active--;
+            }
+        }
+    }
+    if (n > 0) RBTreeCountShared(root, searches, (unsigned long long) n);
+    RBTreeCountShared(root, comparisons, visited);
+
+    return found;
+}
+
+/**
+ * 红黑树从提示结点出发查找数据域为x的结点, 不存在时插入该结点.
+ * 大于最大结点的键直接挂在最大结点右侧, 递增的键只需摊还O(1)的自平衡代价
+ *
+ * @param[in]  root    : the root of the red-black tree
+ * @param[in]  hint    : a node of the tree near x, such as the last inserted node, NULL means the root
+ * @param[in]  x       : the data of the node
+ * @param[out] inserted: 1 if the node is newly inserted, 0 if it already exists
+ * @return  the existing or inserted node, NULL if out of memory
+ */
+RBTree insertHintRBTree(RBRoot *root, Node *hint, RBTreeElemType x, int *inserted)
+{
+    Node *node, *parent;
+
+    if (inserted) *inserted = 0;
+    if (root->rightmost && x > root->rightmost->data) {
+        /* 快速路径只与最大结点比较一次 */
+        RBTreeCount(root, searches, 1);
+        RBTreeCount(root, comparisons, 1);
+        parent = root->rightmost;
+    } else if ((node = searchInsertPosition(root, hint ? BSTreeFingerAncestor(hint, x) : root->node, x, &parent)) != NULL)
+        return node;
+
+    node = createRBTreeNode(root, x, NULL, NULL, NULL);
+    if (!node) return NULL;
+
+    linkBinarySearchTree(root, node, parent);
     RBTreeInsertSelfBalancing(root, node);
+    if (inserted) *inserted = 1;
+
+    return node;
+}
+
+/**
+ * 红黑树插入或更新数据域为x的结点, 对最终结点调用update
+ *
+ * @param[in]  root  : the root of the red-black tree
+ * @param[in]  x     : the data of the node
+ * @param[in]  update: the callback applied to the existing or inserted node
+ * @param[in]  arg   : the argument passed to update
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status upsertRBTree(RBRoot *root, RBTreeElemType x, RBTreeUpsertFunc update, void *arg)
+{
+    int inserted;
+    Node *node = insertOrFindRBTree(root, x, &inserted);
+    if (!node) return FAILED;
+
+    if (update) update(node, inserted, arg);
 
     return SUCCESS;
 }
 
+/**
+ * 按键有序地批量插入和删除, 每个键从上一个键附近的结点出发查找, 不必每次从根结点下降.
+ * 相同键的多个操作按数组顺序执行
+ *
+ * @param[in]  root   : the root of the red-black tree
+ * @param[in]  ops    : the operations sorted by key in non-decreasing order
+ * @param[in]  n      : the number of operations
+ * @param[out] applied: the number of operations that changed the tree, may be NULL;
+ *                      on failure the operations before the failing one stay applied and are counted
+ * @return  the operation status, SUCCESS is 0, FAILED is -1 if ops is not sorted or out of memory
+ */
+Status applyBatchRBTree(RBRoot *root, const RBTreeBatchOp *ops, int n, int *applied)
+{
+    Node *finger = NULL, *node, *parent;
+    int changed = 0, inserted, i;
+    Status status = SUCCESS;
+
+    if (applied) *applied = 0;
+    if (!root || n < 0 || (n > 0 && !ops)) return FAILED;
+    for (i = 1; i < n; i++) if (ops[i].key < ops[i - 1].key) return FAILED;
+
+    for (i = 0; i < n; i++) {
+        RBTreeElemType x = ops[i].key;
+
+        if (ops[i].type == RBTREE_BATCH_INSERT) {
+            node = insertHintRBTree(root, finger, x, &inserted);
+            if (!node) {
+                status = FAILED;
+                break;
+            }
+            changed += inserted;
+            finger = node;
+            continue;
+        }
+
+        node = searchInsertPosition(root, finger ? BSTreeFingerAncestor(finger, x) : root->node, x, &parent);
+        if (node) {
+            /* 删除只重新链接结点, 前驱结点在删除后仍然有效 */
+            finger = BSTreePrecursor(node);
+            deleteRBTreeNode(root, node);
+            changed++;
+        } else finger = parent;
+    }
+    if (applied) *applied = changed;
+
+    return status;
+}
+
 /**
  * 红黑树删除数据域为x的结点
  *
@@ -127,7 +635,7 @@ Status insertRBTree(RBRoot *root, RBTreeElemType x)
 Status deleteRBTree(RBRoot *root, RBTreeElemType x)
 {
     Node *p;
-    if (p = recursiveSearchNode(root->node, x)) {
+    if ((p = searchRBTreeNode(root, x)) != NULL) {
         deleteRBTreeNode(root, p);
         return SUCCESS;
     }
@@ -136,7 +644,7 @@ Status deleteRBTree(RBRoot *root, RBTreeElemType x)
 }
 
 /**
- * 打印红黑树信息
+ * 打印红黑树信息, 启用RBTREE_STATS时再打印统计信息
  *
  * @param[in]  root: the root of the red-black tree
  * @return  the operation status, SUCCESS is 0, FAILED is -1
@@ -145,6 +653,9 @@ Status printRBTree(RBRoot *root)
 {
     if (root && root->node) {
         PrintRBTreeInfo(root->node, root->node->data, 0);
+#if RBTREE_STATS
+        PrintRBTreeStats(root);
+#endif
         return SUCCESS;
     }
 
@@ -1,41 +1,165 @@
 /**
  * @filename RedBlackTreeUtils.c
  * @description Red-Black tree utils interface implementation
- * @author Ԫ
+ * @author 许继元
  * @date 2020/12/18
  */
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include "../HeaderFiles/RedBlackTree.h"
+#include "../HeaderFiles/RedBlackTreeUtils.h"
 #include "../HeaderFiles/BinarySearchTree.h"
 #include "../HeaderFiles/BalancedBinaryTree.h"
+#include "../HeaderFiles/RBTreeStats.h"
 
+#if RBTREE_AUGMENTED
 /**
- * 
+ * 由孩子结点重新计算结点的附加信息, 孩子结点的附加信息必须是最新的
  *
+ * @param[in]  node: the node of the red-black tree
+ * @return  none
+ */
+void RBTreeAugmentNode(Node *node)
+{
+#if RBTREE_ORDER_STATISTICS
+    node->size = RBTreeMultiplicity(node) + (node->left ? node->left->size : 0) + (node->right ? node->right->size : 0);
+#endif
+#if RBTREE_INTERVAL
+    node->maxHi = node->hi;
+    if (node->left && node->left->maxHi > node->maxHi) node->maxHi = node->left->maxHi;
+    if (node->right && node->right->maxHi > node->maxHi) node->maxHi = node->right->maxHi;
+#endif
+}
+
+/**
+ * 从结点到根结点逐个重新计算附加信息, 用于插入和删除后更新路径
+ *
+ * @param[in]  node: the lowest node whose subtree has changed
+ * @return  none
+ */
+void RBTreeAugmentPath(Node *node)
+{
+    while (node) {
+        RBTreeAugmentNode(node);
+        node = RBTreeParent(node);
+    }
+}
+#endif
+
+/**
+ * 分配按缓存行对齐并清零的内存. malloc只保证16字节对齐, 按缓存行填充的槽位仍可能跨越两个缓存行;
+ * 多分配一个缓存行后手动对齐, 原始指针保存在返回地址之前
+ *
+ * @param[in]  size: the number of bytes
+ * @return  the aligned memory, NULL if out of memory
+ */
+void *RBTreeAlignedCalloc(size_t size)
+{
+    char *memory = (char *) calloc(1, size + RBTREE_CACHE_LINE + sizeof(void *));
+    char *aligned;
+
+    if (!memory) return NULL;
+    aligned = (char *) (((uintptr_t) memory + sizeof(void *) + RBTREE_CACHE_LINE - 1)
+                        & ~(uintptr_t) (RBTREE_CACHE_LINE - 1));
+    ((void **) aligned)[-1] = memory;
+
+    return aligned;
+}
+
+/**
+ * 释放RBTreeAlignedCalloc分配的内存
+ *
+ * @param[in]  memory: the aligned memory, may be NULL
+ * @return  none
+ */
+void RBTreeAlignedFree(void *memory)
+{
+    if (memory) free(((void **) memory)[-1]);
+}
+
+/**
+ * 创建红黑树结点
+ *
+ * @param[in]  root  : the root of the red-black tree
  * @param[in]  x     : the data of the node
  * @param[in]  parent: its parent node
  * @param[in]  left  : its left child node
  * @param[in]  right : its right child node
  * @return  the new red-black tree node pointer
  */
-RBTree createRBTreeNode(RBTreeElemType x, Node *parent, Node *left, Node *right)
+RBTree createRBTreeNode(RBRoot *root, RBTreeElemType x, Node *parent, Node *left, Node *right)
 {
-    RBTree node = (Node *) malloc(sizeof(Node));
+    RBTree node;
+    if (root->allocator) node = root->allocator->allocNode(root->allocator->context);
+    else node = (Node *) malloc(sizeof(Node));
     if (!node) return NULL;
+    RBTreeCount(root, allocations, 1);
 
     node->data = x;
     node->left = left;
     node->right = right;
-    node->parent = parent;
-    node->color = BLACK;
+#if RBTREE_MULTISET
+    node->count = 1;
+#endif
+#if RBTREE_INTERVAL
+    node->hi = x;
+#endif
+    RBTreeSetParentColor(node, parent, BLACK);
+    RBTreeAugmentNode(node);
 
     return node;
 }
 
 /**
- * ƽ
+ * 释放红黑树结点
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  node: the node to be released
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status freeRBTreeNode(RBRoot *root, Node *node)
+{
+    if (!node) return FAILED;
+    RBTreeCount(root, frees, 1);
+
+    if (root->allocator) root->allocator->freeNode(root->allocator->context, node);
+    else free(node);
+
+    return SUCCESS;
+}
+
+/**
+ * 通过分配器释放红黑树的全部结点, 通过旋转拉直后逐个释放, 只使用常数额外空间
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @param[in]  tree: the node of the red-black tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status destroyRBTreeNodes(RBRoot *root, RBTree tree)
+{
+    if (!tree) return FAILED;
+
+    Node *p = tree, *next;
+
+    while (p) {
+        if (p->left) {  /* 右旋摘下左孩子, 把树逐步拉直成右链 */
+            next = p->left;
+            p->left = next->right;
+            next->right = p;
+        } else {
+            next = p->right;
+            freeRBTreeNode(root, p);
+        }
+        p = next;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * 红黑树插入结点后自平衡
  *
  * @param[in]  root: the root of the red-black tree
  * @param[in]  node: the inserted node
@@ -45,31 +169,34 @@ Status RBTreeInsertSelfBalancing(RBRoot *root, Node *node)
 {
     Node *parent, *grandparent;
 
-    /* Ϊɫ */
+    /* 父结点为红色结点 */
     while ((parent = RBTreeParent(node)) && RBTreeIsRed(parent)) {
         grandparent = RBTreeParent(parent);
+        RBTreeCount(root, insertFixups, 1);
 
-        /* 游ӽ㡱 */
+        /* 父结点是祖父结点的左孩子结点” */
         if (parent == grandparent->left) {
             Node *uncle = grandparent->right;
 
-            /* Ǻɫ */
+            /* 叔叔结点是红色结点 */
             if (uncle && RBTreeIsRed(uncle)) {
                 RBTreeSetBlack(parent);
                 RBTreeSetBlack(uncle);
                 RBTreeSetRed(grandparent);
+                RBTreeCount(root, recolors, 3);
                 node = grandparent;
                 continue;
             }
 
-            /* 㲻, Ҳ丸ӽ */
+            /* 叔叔结点不存在, 且插入结点是其父结点的左孩子结点 */
             if (node == parent->left) {
                 RBTreeSetBlack(parent);
                 RBTreeSetRed(grandparent);
+                RBTreeCount(root, recolors, 2);
                 RBTreeRightRotate(root, grandparent);
             }
 
-            /* 㲻, Ҳ丸Һӽ */
+            /* 叔叔结点不存在, 且插入结点是其父结点的右孩子结点 */
             if (node == parent->right) {
                 Node *temp;
                 RBTreeLeftRotate(root, parent);
@@ -77,26 +204,28 @@ Status RBTreeInsertSelfBalancing(RBRoot *root, Node *node)
                 parent = node;
                 node = temp;
             }
-        } else { /* 游Һӽ㡱 */
+        } else { /* 父结点是祖父结点的右孩子结点” */
             Node *uncle = grandparent->left;
 
-            /* Ǻɫ */
+            /* 叔叔结点是红色结点 */
             if (uncle && RBTreeIsRed(uncle)) {
                 RBTreeSetBlack(uncle);
                 RBTreeSetBlack(parent);
                 RBTreeSetRed(grandparent);
+                RBTreeCount(root, recolors, 3);
                 node = grandparent;
                 continue;
             }
 
-            /* 㲻, Ҳ丸Һӽ */
+            /* 叔叔结点不存在, 且插入结点是其父结点的右孩子结点 */
             if (node == parent->right) {
                 RBTreeSetBlack(parent);
                 RBTreeSetRed(grandparent);
+                RBTreeCount(root, recolors, 2);
                 RBTreeLeftRotate(root, grandparent);
             }
 
-            /* 㲻, Ҳ丸ӽ */
+            /* 叔叔结点不存在, 且插入结点是其父结点的左孩子结点 */
             if (node == parent->left) {
                 Node *temp;
                 RBTreeRightRotate(root, parent);
@@ -107,13 +236,14 @@ Status RBTreeInsertSelfBalancing(RBRoot *root, Node *node)
         }
     }
 
+    RBTreeCount(root, recolors, RBTreeIsRed(root->node));
     RBTreeSetBlack(root->node);
 
     return SUCCESS;
 }
 
 /**
- * С
+ * 红黑树查找最小结点
  *
  * @param[in]  root  : the root of the red-black tree
  * @param[in]  minVal: the minimum value of the red-black tree
@@ -132,7 +262,7 @@ Status minRBTreeNode(RBRoot *root, RBTreeElemType *minVal)
 }
 
 /**
- * 
+ * 红黑树查找最大结点
  *
  * @param[in]  root  : the root of the red-black tree
  * @param[in]  maxVal: the maximum value of the red-black tree
@@ -151,7 +281,7 @@ Status maxRBTreeNode(RBRoot *root, RBTreeElemType *maxVal)
 }
 
 /**
- * ɾƽ
+ * 红黑树删除结点后自平衡
  *
  * @param[in]  root  : the root of the red-black tree
  * @param[in]  node  : the deleted node
@@ -163,32 +293,37 @@ Status RBTreeDeleteSelfBalancing(RBRoot *root, Node *node, Node *parent)
     Node *sibling = NULL;
 
     while ((!node || RBTreeIsBlack(node)) && node != root->node) {
+        RBTreeCount(root, deleteFixups, 1);
         if (node == parent->left) {
             sibling = parent->right;
-            /* nodeֵܽsiblingǺɫ */
+            /* node的兄弟结点sibling是红色结点 */
             if (RBTreeIsRed(sibling)) {
                 RBTreeSetBlack(sibling);
                 RBTreeSetRed(parent);
+                RBTreeCount(root, recolors, 2);
                 RBTreeLeftRotate(root, parent);
                 sibling = parent->right;
             }
-            /* nodeֵܽsiblingǺɫ, sibling2ӽ㶼Ǻɫ */
+            /* node的兄弟结点sibling是黑色结点, sibling的2个孩子结点都是黑色结点 */
             if ((!sibling->left || RBTreeIsBlack(sibling->left)) &&
                 (!sibling->right || RBTreeIsBlack(sibling->right))) {
                 RBTreeSetRed(sibling);
+                RBTreeCount(root, recolors, 1);
                 node = parent;
                 parent = RBTreeParent(node);
             } else {
-                /* nodeֵܽsiblingǺɫ, siblingǺɫ, ҺǺɫ */
+                /* node的兄弟结点sibling是黑色结点, sibling的左孩子是红色, 右孩子是黑色 */
                 if (!sibling->right || RBTreeIsBlack(sibling->right)) {
                     RBTreeSetRed(sibling);
                     RBTreeSetBlack(sibling->left);
+                    RBTreeCount(root, recolors, 2);
                     RBTreeRightRotate(root, sibling);
                     sibling = parent->right;
                 }
-                /* nodeֵܽsiblingǺɫ, siblingɫ, ҺǺɫ */
+                /* node的兄弟结点sibling是黑色结点, sibling的左孩子是任意颜色, 右孩子是红色 */
                 RBTreeSetColor(sibling, RBTreeColor(parent));
                 RBTreeSetBlack(parent);
+                RBTreeCount(root, recolors, 3);
                 RBTreeSetBlack(sibling->right);
                 RBTreeLeftRotate(root, parent);
                 node = root->node;
@@ -196,30 +331,34 @@ Status RBTreeDeleteSelfBalancing(RBRoot *root, Node *node, Node *parent)
             }
         } else {
             sibling = parent->left;
-            /* nodeֵܽsiblingǺɫ */
+            /* node的兄弟结点sibling是红色结点 */
             if (RBTreeIsRed(sibling)) {
                 RBTreeSetBlack(sibling);
                 RBTreeSetRed(parent);
+                RBTreeCount(root, recolors, 2);
                 RBTreeRightRotate(root, parent);
                 sibling = parent->left;
             }
-            /* nodeֵܽsiblingǺɫ, sibling2ӽ㶼Ǻɫ */
+            /* node的兄弟结点sibling是黑色结点, sibling的2个孩子结点都是黑色结点 */
             if ((!sibling->left || RBTreeIsBlack(sibling->left)) &&
                 (!sibling->right || RBTreeIsBlack(sibling->right))) {
                 RBTreeSetRed(sibling);
+                RBTreeCount(root, recolors, 1);
                 node = parent;
                 parent = RBTreeParent(node);
             } else {
-                /* nodeֵܽsiblingǺɫ, siblingǺɫ, ҺǺɫ */
+                /* node的兄弟结点sibling是黑色结点, sibling的左孩子是红色, 右孩子是黑色 */
                 if (!sibling->left || RBTreeIsBlack(sibling->left)) {
                     RBTreeSetBlack(sibling->right);
                     RBTreeSetRed(sibling);
+                    RBTreeCount(root, recolors, 2);
                     RBTreeLeftRotate(root, sibling);
                     sibling = parent->left;
                 }
-                /* nodeֵܽsiblingǺɫ, siblingɫ, ҺǺɫ */
+                /* node的兄弟结点sibling是黑色结点, sibling的左孩子是任意颜色, 右孩子是红色 */
                 RBTreeSetColor(sibling, RBTreeColor(parent));
                 RBTreeSetBlack(parent);
+                RBTreeCount(root, recolors, 3);
                 RBTreeSetBlack(sibling->left);
                 RBTreeRightRotate(root, parent);
                 node = root->node;
@@ -227,13 +366,16 @@ Status RBTreeDeleteSelfBalancing(RBRoot *root, Node *node, Node *parent)
             }
         }
     }
-    if (node) RBTreeSetBlack(node);
+    if (node) {
+        RBTreeCount(root, recolors, RBTreeIsRed(node));
+        RBTreeSetBlack(node);
+    }
 
     return SUCCESS;
 }
 
 /**
- * ɾָ
+ * 红黑树删除结点指针
  *
  * @param[in]  root: the root of the red-black tree
  * @param[in]  node: the deleted node
@@ -244,71 +386,76 @@ Status deleteRBTreeNode(RBRoot *root, Node *node)
     Node *child = NULL, *parent = NULL;
     int color;
 
-    /* ɾҺӽ㶼 */
+    /* 最大结点没有右孩子, 其前驱为左孩子或父结点 */
+    if (node == root->rightmost) root->rightmost = BSTreePrecursor(node);
+
+    /* 删除结点的左右孩子结点都存在 */
     if (node->left && node->right) {
         Node *replace = node;
-        /* , ̽ */
+        /* 替代结点, 即后继结点 */
         replace = replace->right;
-        /* ȡСĺ̽ */
+        /* 获取最小的后继结点 */
         while (replace->left) replace = replace->left;
 
-        /* node㲻Ǹ */
+        /* node结点不是根结点 */
         if (RBTreeParent(node)) {
-            if (node == RBTreeParent(node)->left) RBTreeParent(node)->left = replace;
-            else RBTreeParent(node)->right = replace;
-        } else root->node = replace;  /* nodeǸ */
+            if (node == RBTreeParent(node)->left) RBTreeStoreLink(RBTreeParent(node)->left, replace);
+            else RBTreeStoreLink(RBTreeParent(node)->right, replace);
+        } else RBTreeStoreLink(root->node, replace);  /* node结点是根结点 */
 
-        /* childҺ, Ҫλ */
+        /* child是替代结点的右孩子, 可能需要填补替代结点的位置 */
         child = replace->right;
-        /* ĸ */
+        /* 保存替代结点的父结点 */
         parent = RBTreeParent(replace);
-        /* ɫ */
+        /* 保存替代结点的颜色 */
         color = RBTreeColor(replace);
 
-        /* ɾҺӽ */
+        /* 替代结点是删除结点的右孩子结点 */
         if (parent == node) parent = replace;
         else {
             if (child) RBTreeSetParent(child, parent);
-            /* Һӽλ(㲻ӽ, Ǻ̽) */
-            parent->left = child;
-            replace->right = node->right;
+            /* 替代结点的右孩子结点填补替代结点的位置(替代结点不可能有左孩子结点, 否则其才是后继结点) */
+            RBTreeStoreLink(parent->left, child);
+            RBTreeStoreLink(replace->right, node->right);
             RBTreeSetParent(node->right, replace);
         }
 
-        /*  */
-        replace->parent = node->parent;
-        replace->color = node->color;
-        replace->left = node->left;
-        node->left->parent = replace;
+        /* 替代结点操作 */
+        RBTreeSetParent(replace, RBTreeParent(node));
+        RBTreeSetColor(replace, RBTreeColor(node));
+        RBTreeStoreLink(replace->left, node->left);
+        RBTreeSetParent(node->left, replace);
+        RBTreeAugmentPath(parent);
 
-        /* Ϊɫ, Ҫƽ */
+        /* 替代结点为黑色, 需要自平衡 */
         if (color == BLACK) RBTreeDeleteSelfBalancing(root, child, parent);
-        free(node);
+        freeRBTreeNode(root, node);
 
         return SUCCESS;
     }
 
-    /* ɾֻһӽûкӽ */
+    /* 删除结点只存在一个孩子结点或者没有孩子结点 */
     if (node->left) child = node->left;
     else child = node->right;
-    parent = node->parent;
-    color = node->color;
-    if (child) child->parent = parent;
+    parent = RBTreeParent(node);
+    color = RBTreeColor(node);
+    if (child) RBTreeSetParent(child, parent);
 
-    /* node㲻Ǹ */
+    /* node结点不是根结点 */
     if (parent) {
-        if (node == parent->left) parent->left = child;
-        else parent->right = child;
-    } else root->node = child;
+        if (node == parent->left) RBTreeStoreLink(parent->left, child);
+        else RBTreeStoreLink(parent->right, child);
+    } else RBTreeStoreLink(root->node, child);
+    RBTreeAugmentPath(parent);
 
     if (color == BLACK) RBTreeDeleteSelfBalancing(root, child, parent);
-    free(node);
+    freeRBTreeNode(root, node);
 
     return SUCCESS;
 }
 
 /**
- * ϢĴӡ
+ * 红黑树信息的打印, 沿父结点指针前序遍历, 不使用递归
  *
  * @param[in]  tree    : the node of the red-black tree
  * @param[in]  data    : the data of the node
@@ -319,22 +466,68 @@ Status deleteRBTreeNode(RBRoot *root, Node *node)
  */
 Status PrintRBTreeInfo(RBTree tree, RBTreeElemType data, int position)
 {
-    if (tree) {
-        if (position == 0) printf("[%d] () Ǹڵ\n", tree->data);
-        else printf("[%d] (%s)  [%d]  {%s} ӽ\n", tree->data, RBTreeIsRed(tree) ? "" : "",
-                    data, position == -1 ? "" : "");
+    if (!tree) return FAILED;
 
-        PrintRBTreeInfo(tree->left, tree->data, -1);
-        PrintRBTreeInfo(tree->right, tree->data, 1);
+    Node *stop = RBTreeParent(tree);
+    Node *prev = stop, *p = tree;
 
-        return SUCCESS;
+    while (p != stop) {
+        if (prev == RBTreeParent(p)) {  /* 从父结点下降而来, 打印当前结点 */
+            if (p != tree) {
+                data = RBTreeParent(p)->data;
+                position = p == RBTreeParent(p)->left ? -1 : 1;
+            }
+            if (position == 0) printf("[%d] (黑) 是根节点\n", p->data);
+            else printf("[%d] (%s) 是 [%d] 的 {%s} 孩子结点\n", p->data, RBTreeIsRed(p) ? "红" : "黑",
+                        data, position == -1 ? "左" : "右");
+
+            prev = p;
+            if (p->left) p = p->left;
+            else if (p->right) p = p->right;
+            else p = RBTreeParent(p);
+        } else if (prev == p->left && p->right) {  /* 从左子树返回, 进入右子树 */
+            prev = p;
+            p = p->right;
+        } else {  /* 左右子树均已打印 */
+            prev = p;
+            p = RBTreeParent(p);
+        }
     }
 
-    return FAILED;
+    return SUCCESS;
+}
+
+/**
+ * 红黑树统计信息的打印, 未启用RBTREE_STATS时只打印结构和内存信息.
+ * printRBTree只在启用RBTREE_STATS时调用本函数, 默认的打印输出保持不变
+ *
+ * @param[in]  root: the root of the red-black tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status PrintRBTreeStats(RBRoot *root)
+{
+    RBTreeStats stats;
+
+    if (getRBTreeStats(root, &stats) != SUCCESS) return FAILED;
+
+    printf("结点数: %ld, 高度: %d, 黑高: %d\n", stats.nodes, stats.height, stats.blackHeight);
+    printf("内存: 结点占用 %lu 字节, 已申请 %lu 字节, 碎片率 %.1f%%\n",
+           (unsigned long) stats.liveBytes, (unsigned long) stats.reservedBytes, stats.fragmentation * 100);
+#if RBTREE_STATS
+    printf("旋转: %llu, 重新着色: %llu, 插入自平衡循环: %llu, 删除自平衡循环: %llu\n",
+           stats.counters.rotations, stats.counters.recolors,
+           stats.counters.insertFixups, stats.counters.deleteFixups);
+    printf("下降: %llu, 平均每次下降比较: %.2f, 分配结点: %llu, 释放结点: %llu\n",
+           stats.counters.searches,
+           stats.counters.searches ? (double) stats.counters.comparisons / stats.counters.searches : 0.0,
+           stats.counters.allocations, stats.counters.frees);
+#endif
+
+    return SUCCESS;
 }
 
 /**
- * 뷨ӡ
+ * 凹入法打印红黑树
  *
  * @param[in]  tree : the node of the red-black tree
  * @param[in]  depth: the depth of the red-black tree node
@@ -345,7 +538,7 @@ Status recessedPrintRBTree(RBTree tree, int depth)
     if (!tree) return FAILED;
     recessedPrintRBTree(tree->right, depth + 1);
     for (int i = 0; i < depth; i++) printf("    ");
-    printf("[%-d(%s)]\n", tree->data, RBTreeIsRed(tree) ? "" : "");
+    printf("[%-d(%s)]\n", tree->data, RBTreeIsRed(tree) ? "红" : "黑");
     recessedPrintRBTree(tree->left, depth + 1);
 
     return SUCCESS;
@@ -0,0 +1,401 @@
+/**
+ * @filename ShardedRBTree.c
+ * @description Key-range sharded Red-Black tree interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 每个分片是一棵独立的红黑树, 拥有自己的锁和结点池, 不同分片上的写操作可以并行.
+ * 路由时不加锁读取分片边界, 锁住分片后再确认键仍归该分片所有;
+ * 调整边界时按下标顺序锁住全部分片, 因此持有任一分片锁时边界不会变化.
+ */
+
+#include <stdlib.h>
+#include "../HeaderFiles/ShardedRBTree.h"
+#include "../HeaderFiles/RedBlackTreeUtils.h"
+
+#if RBTREE_SHARDED
+
+/* 收集分片中全部键的游标 */
+typedef struct RBTreeKeyCollector {
+    RBTreeElemType *keys;
+    int count;
+} RBTreeKeyCollector;
+
+static int collectKey(Node *node, void *arg)
+{
+    RBTreeKeyCollector *collector = (RBTreeKeyCollector *) arg;
+    collector->keys[collector->count++] = node->data;
+
+    return 0;
+}
+
+/**
+ * 二分查找负责键x的分片, 即下界不大于x的最后一个分片
+ *
+ * @param[in]  tree: the sharded red-black tree
+ * @param[in]  x   : the key
+ * @return  the index of the shard
+ */
+static int routeShard(ShardedRBTree *tree, RBTreeElemType x)
+{
+    int lo = 0, hi = tree->shardCount - 1;
+
+    while (lo < hi) {
+        int mid = lo + (hi - lo + 1) / 2;
+        if (__atomic_load_n(&tree->shards[mid].lo, __ATOMIC_RELAXED) <= x) lo = mid;
+        else hi = mid - 1;
+    }
+
+    return lo;
+}
+
+/**
+ * 锁住负责键x的分片, 路由与加锁之间边界被调整时重新路由
+ *
+ * @param[in]  tree: the sharded red-black tree
+ * @param[in]  x   : the key
+ * @return  the locked shard
+ */
+static RBTreeShard *lockShard(ShardedRBTree *tree, RBTreeElemType x)
+{
+    for (;;) {
+        int i = routeShard(tree, x);
+        RBTreeShard *shard = &tree->shards[i];
+
+        pthread_mutex_lock(&shard->lock);
+        if ((i == 0 || shard->lo <= x) && (i + 1 == tree->shardCount || x < tree->shards[i + 1].lo)) return shard;
+        pthread_mutex_unlock(&shard->lock);
+    }
+}
+
+/**
+ * 判断结点数为count的分片相对最小的分片是否倾斜, 即count > SKEW * (最小分片的结点数 + CHECK_INTERVAL).
+ * 加上检查间隔作为余量, 避免分片都很小时因少量插入就反复重新划分
+ *
+ * @param[in]  tree : the sharded red-black tree
+ * @param[in]  count: the number of nodes in the shard
+ * @return  1 if the shard is skewed, otherwise 0
+ */
+static int isShardSkewed(ShardedRBTree *tree, int count)
+{
+    int minCount = count, i;
+
+    for (i = 0; i < tree->shardCount; i++) {
+        int c = __atomic_load_n(&tree->shards[i].count, __ATOMIC_RELAXED);
+        if (c < minCount) minCount = c;
+    }
+
+    return (long long) count > (long long) RBTREE_SHARD_SKEW * (minCount + RBTREE_SHARD_CHECK_INTERVAL);
+}
+
+/**
+ * 重新划分分片边界, 使各分片结点数相等, 并由有序键线性时间重建各分片
+ *
+ * @param[in]  tree         : the sharded red-black tree
+ * @param[in]  onlyIfSkewed : 1 to skip when no shard is skewed any more
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+static Status rebalanceShards(ShardedRBTree *tree, int onlyIfSkewed)
+{
+    RBTreeKeyCollector collector = {NULL, 0};
+    RBRoot **roots = NULL;
+    int total = 0, maxCount = 0, i;
+    Status status = SUCCESS;
+
+    pthread_mutex_lock(&tree->rebalanceLock);
+    for (i = 0; i < tree->shardCount; i++) {
+        pthread_mutex_lock(&tree->shards[i].lock);
+        total += tree->shards[i].count;
+        if (tree->shards[i].count > maxCount) maxCount = tree->shards[i].count;
+    }
+    if (total == 0 || (onlyIfSkewed && !isShardSkewed(tree, maxCount))) goto unlock;
+
+    collector.keys = (RBTreeElemType *) malloc(sizeof(RBTreeElemType) * total);
+    roots = (RBRoot **) calloc((size_t) tree->shardCount, sizeof(RBRoot *));
+    if (!collector.keys || !roots) {
+        status = FAILED;
+        goto unlock;
+    }
+    for (i = 0; i < tree->shardCount; i++) visitRBTree(tree->shards[i].root, RBTREE_INORDER, collectKey, &collector);
+
+    /* 先建好全部新分片, 内存不足时保持原状 */
+    for (i = 0; i < tree->shardCount; i++) {
+        int begin = (int) ((long long) i * total / tree->shardCount);
+        int end = (int) ((long long) (i + 1) * total / tree->shardCount);
+        roots[i] = createPooledRBTree(0);
+        if (!roots[i] || buildRBTreeFromSorted(roots[i], collector.keys + begin, end - begin) == FAILED) {
+            status = FAILED;
+            break;
+        }
+    }
+    if (status == FAILED) {
+        for (i = 0; i < tree->shardCount; i++) if (roots[i]) destroyRBTree(roots[i]);
+        goto unlock;
+    }
+
+    for (i = 0; i < tree->shardCount; i++) {
+        RBTreeShard *shard = &tree->shards[i];
+        int begin = (int) ((long long) i * total / tree->shardCount);
+        int end = (int) ((long long) (i + 1) * total / tree->shardCount);
+
+        destroyRBTree(shard->root);
+        shard->root = roots[i];
+        __atomic_store_n(&shard->count, end - begin, __ATOMIC_RELAXED);
+        shard->inserts = 0;
+        if (i > 0) __atomic_store_n(&shard->lo, collector.keys[begin], __ATOMIC_RELAXED);
+    }
+
+unlock:
+    for (i = tree->shardCount - 1; i >= 0; i--) pthread_mutex_unlock(&tree->shards[i].lock);
+    pthread_mutex_unlock(&tree->rebalanceLock);
+    free(collector.keys);
+    free(roots);
+
+    return status;
+}
+
+/**
+ * 创建分片红黑树, 按预期的键范围[lo, hi)均匀划分初始边界
+ *
+ * @param[in]  shardCount: the number of shards
+ * @param[in]  lo        : the expected smallest key
+ * @param[in]  hi        : one past the expected largest key
+ * @return  the sharded red-black tree, NULL if out of memory
+ */
+ShardedRBTree *createShardedRBTree(int shardCount, RBTreeElemType lo, RBTreeElemType hi)
+{
+    ShardedRBTree *tree;
+    int i;
+
+    if (shardCount <= 0 || hi < lo) return NULL;
+    tree = (ShardedRBTree *) malloc(sizeof(ShardedRBTree));
+    if (!tree) return NULL;
+    tree->shards = (RBTreeShard *) RBTreeAlignedCalloc((size_t) shardCount * sizeof(RBTreeShard));
+    if (!tree->shards) {
+        free(tree);
+        return NULL;
+    }
+    tree->shardCount = shardCount;
+    pthread_mutex_init(&tree->rebalanceLock, NULL);
+
+    for (i = 0; i < shardCount; i++) {
+        RBTreeShard *shard = &tree->shards[i];
+        pthread_mutex_init(&shard->lock, NULL);
+        shard->lo = (RBTreeElemType) (lo + ((long long) hi - lo) * i / shardCount);
+        shard->root = createPooledRBTree(0);
+        if (!shard->root) {
+            tree->shardCount = i + 1;
+            destroyShardedRBTree(tree);
+            return NULL;
+        }
+    }
+
+    return tree;
+}
+
+/**
+ * 销毁分片红黑树, 调用时不能有其他线程正在访问
+ *
+ * @param[in]  tree: the sharded red-black tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status destroyShardedRBTree(ShardedRBTree *tree)
+{
+    int i;
+
+    if (!tree) return FAILED;
+
+    for (i = 0; i < tree->shardCount; i++) {
+        if (tree->shards[i].root) destroyRBTree(tree->shards[i].root);
+        pthread_mutex_destroy(&tree->shards[i].lock);
+    }
+    pthread_mutex_destroy(&tree->rebalanceLock);
+    RBTreeAlignedFree(tree->shards);
+    free(tree);
+
+    return SUCCESS;
+}
+
+/**
+ * 分片红黑树插入结点, 分片明显倾斜时随后重新划分边界
+ *
+ * @param[in]  tree: the sharded red-black tree
+ * @param[in]  x   : the data to be inserted
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status insertShardedRBTree(ShardedRBTree *tree, RBTreeElemType x)
+{
+    RBTreeShard *shard;
+    Status status;
+    int skewed = 0;
+
+    if (!tree) return FAILED;
+
+    shard = lockShard(tree, x);
+    status = insertRBTree(shard->root, x);
+    if (status == SUCCESS) {
+        __atomic_store_n(&shard->count, shard->count + 1, __ATOMIC_RELAXED);
+        if (++shard->inserts >= RBTREE_SHARD_CHECK_INTERVAL) {
+            shard->inserts = 0;
+            skewed = isShardSkewed(tree, shard->count);
+        }
+    }
+    pthread_mutex_unlock(&shard->lock);
+
+    if (skewed) rebalanceShards(tree, 1);
+
+    return status;
+}
+
+/**
+ * 分片红黑树删除结点
+ *
+ * @param[in]  tree: the sharded red-black tree
+ * @param[in]  x   : the data to be deleted
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status deleteShardedRBTree(ShardedRBTree *tree, RBTreeElemType x)
+{
+    RBTreeShard *shard;
+    Status status;
+
+    if (!tree) return FAILED;
+
+    shard = lockShard(tree, x);
+    status = deleteRBTree(shard->root, x);
+    if (status == SUCCESS) __atomic_store_n(&shard->count, shard->count - 1, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&shard->lock);
+
+    return status;
+}
+
+/**
+ * 分片红黑树查找结点
+ *
+ * @param[in]  tree: the sharded red-black tree
+ * @param[in]  x   : the data to be searched
+ * @return  SUCCESS if x is found, otherwise FAILED
+ */
+Status searchShardedRBTree(ShardedRBTree *tree, RBTreeElemType x)
+{
+    RBTreeShard *shard;
+    Status status;
+
+    if (!tree) return FAILED;
+
+    shard = lockShard(tree, x);
+    status = searchRBTreeNode(shard->root, x) ? SUCCESS : FAILED;
+    pthread_mutex_unlock(&shard->lock);
+
+    return status;
+}
+
+/**
+ * 分片红黑树的最小值, 即第一个非空分片的最小值
+ *
+ * @param[in]  tree  : the sharded red-black tree
+ * @param[out] minVal: the minimum value
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status minShardedRBTree(ShardedRBTree *tree, RBTreeElemType *minVal)
+{
+    Status status = FAILED;
+    int i;
+
+    if (!tree) return FAILED;
+
+    /* 持有调整锁, 键不会在扫描过程中移动到已扫描过的分片 */
+    pthread_mutex_lock(&tree->rebalanceLock);
+    for (i = 0; i < tree->shardCount && status == FAILED; i++) {
+        pthread_mutex_lock(&tree->shards[i].lock);
+        status = minRBTreeNode(tree->shards[i].root, minVal);
+        pthread_mutex_unlock(&tree->shards[i].lock);
+    }
+    pthread_mutex_unlock(&tree->rebalanceLock);
+
+    return status;
+}
+
+/**
+ * 分片红黑树的最大值, 即最后一个非空分片的最大值
+ *
+ * @param[in]  tree  : the sharded red-black tree
+ * @param[out] maxVal: the maximum value
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status maxShardedRBTree(ShardedRBTree *tree, RBTreeElemType *maxVal)
+{
+    Status status = FAILED;
+    int i;
+
+    if (!tree) return FAILED;
+
+    pthread_mutex_lock(&tree->rebalanceLock);
+    for (i = tree->shardCount - 1; i >= 0 && status == FAILED; i--) {
+        pthread_mutex_lock(&tree->shards[i].lock);
+        status = maxRBTreeNode(tree->shards[i].root, maxVal);
+        pthread_mutex_unlock(&tree->shards[i].lock);
+    }
+    pthread_mutex_unlock(&tree->rebalanceLock);
+
+    return status;
+}
+
+/**
+ * 分片红黑树的结点数, 有并发写入时为近似值
+ *
+ * @param[in]  tree: the sharded red-black tree
+ * @return  the number of nodes
+ */
+int sizeShardedRBTree(ShardedRBTree *tree)
+{
+    int size = 0, i;
+
+    if (!tree) return 0;
+    for (i = 0; i < tree->shardCount; i++) size += __atomic_load_n(&tree->shards[i].count, __ATOMIC_RELAXED);
+
+    return size;
+}
+
+/**
+ * 按键的全局顺序遍历分片红黑树, 依次锁住每个分片做中序遍历.
+ * 遍历期间边界不会调整, 输出严格递增; 并发写入的键可能出现也可能不出现.
+ * visit中不能修改该分片红黑树.
+ *
+ * @param[in]  tree : the sharded red-black tree
+ * @param[in]  visit: the callback applied to each node, non-zero stops the traversal
+ * @param[in]  arg  : the argument passed to visit
+ * @return  SUCCESS if all nodes are visited, FAILED if stopped by visit
+ */
+Status visitShardedRBTree(ShardedRBTree *tree, RBTreeVisitFunc visit, void *arg)
+{
+    Status status = SUCCESS;
+    int i;
+
+    if (!tree || !visit) return FAILED;
+
+    pthread_mutex_lock(&tree->rebalanceLock);
+    for (i = 0; i < tree->shardCount && status == SUCCESS; i++) {
+        pthread_mutex_lock(&tree->shards[i].lock);
+        status = visitRBTree(tree->shards[i].root, RBTREE_INORDER, visit, arg);
+        pthread_mutex_unlock(&tree->shards[i].lock);
+    }
+    pthread_mutex_unlock(&tree->rebalanceLock);
+
+    return status;
+}
+
+/**
+ * 按当前键分布重新划分分片边界, 使各分片结点数相等
+ *
+ * @param[in]  tree: the sharded red-black tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status rebalanceShardedRBTree(ShardedRBTree *tree)
+{
+    if (!tree) return FAILED;
+
+    return rebalanceShards(tree, 0);
+}
+
+#endif /* RBTREE_SHARDED */
@@ -0,0 +1,308 @@
+/**
+ * @filename TopDownRBTree.c
+ * @description Parent-pointer-free top-down Red-Black tree interface implementation
+ * @author 许继元
+ * @date 2026/10/18
+ *
+ * 插入和删除都只从根结点向下走一趟, 在下降途中通过颜色翻转和旋转提前消除
+ * 可能的违规, 到达目标位置时无需回溯, 因此结点不需要父结点指针.
+ * 下降时只保留最近的四代祖先; 伪根head的右孩子是真正的根结点, 使根结点的旋转
+ * 与其他结点一致. 旋转只改写两个孩子指针, 不再改写父结点指针.
+ * 删除把待删除结点的键替换为其前驱的键, 再删除前驱结点, 因此删除后结点地址与键的对应关系会变化.
+ */
+
+#include <stdlib.h>
+#include "../HeaderFiles/TopDownRBTree.h"
+
+#define TopDownIsRed(r) ((r) && (r)->color == RED)
+
+static TopDownNode *createTopDownNode(RBTreeElemType x)
+{
+    TopDownNode *node = (TopDownNode *) malloc(sizeof(TopDownNode));
+    if (!node) return NULL;
+
+    node->data = x;
+    node->color = RED;
+    node->link[0] = node->link[1] = NULL;
+
+    return node;
+}
+
+/**
+ * 单旋转: 结点root向dir方向旋转, 旋转后新的子树根结点为黑色, root为红色
+ *
+ * @param[in]  root: the subtree root
+ * @param[in]  dir : 0 to rotate left, 1 to rotate right
+ * @return  the new subtree root
+ */
+static TopDownNode *singleRotate(TopDownNode *root, int dir)
+{
+    TopDownNode *save = root->link[!dir];
+
+    root->link[!dir] = save->link[dir];
+    save->link[dir] = root;
+    root->color = RED;
+    save->color = BLACK;
+
+    return save;
+}
+
+/* 双旋转: 先将root的!dir侧孩子向!dir方向旋转, 再将root向dir方向旋转 */
+static TopDownNode *doubleRotate(TopDownNode *root, int dir)
+{
+    root->link[!dir] = singleRotate(root->link[!dir], !dir);
+
+    return singleRotate(root, dir);
+}
+
+/**
+ * 创建自顶向下的红黑树
+ *
+ * @param[in]  none
+ * @return  the tree, NULL if out of memory
+ */
+TopDownRBTree *createTopDownRBTree()
+{
+    TopDownRBTree *tree = (TopDownRBTree *) malloc(sizeof(TopDownRBTree));
+    if (!tree) return NULL;
+
+    tree->root = NULL;
+    tree->count = 0;
+
+    return tree;
+}
+
+/**
+ * 销毁自顶向下的红黑树, 通过旋转拉直后逐个释放, 只使用常数额外空间
+ *
+ * @param[in]  tree: the tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1
+ */
+Status destroyTopDownRBTree(TopDownRBTree *tree)
+{
+    TopDownNode *p, *next;
+
+    if (!tree) return FAILED;
+
+    for (p = tree->root; p; p = next) {
+        if (p->link[0]) {  /* 右旋摘下左孩子, 把树逐步拉直成右链 */
+            next = p->link[0];
+            p->link[0] = next->link[1];
+            next->link[1] = p;
+        } else {
+            next = p->link[1];
+            free(p);
+        }
+    }
+    free(tree);
+
+    return SUCCESS;
+}
+
+/**
+ * 查找键x
+ *
+ * @param[in]  tree: the tree
+ * @param[in]  x   : the key
+ * @return  SUCCESS if found, FAILED otherwise
+ */
+Status searchTopDownRBTree(TopDownRBTree *tree, RBTreeElemType x)
+{
+    TopDownNode *p = tree ? tree->root : NULL;
+
+    while (p && p->data != x) p = p->link[p->data < x];
+
+    return p ? SUCCESS : FAILED;
+}
+
+/**
+ * 自顶向下单趟插入: 下降途中遇到两个孩子都是红色的结点就做颜色翻转,
+ * 翻转或新结点与父结点形成连续红色时, 立即以祖父结点为轴旋转消除
+ *
+ * @param[in]  tree: the tree
+ * @param[in]  x   : the key
+ * @return  the operation status, SUCCESS is 0, FAILED is -1 if x exists or out of memory
+ */
+Status insertTopDownRBTree(TopDownRBTree *tree, RBTreeElemType x)
+{
+    TopDownNode head = {0, BLACK, {NULL, NULL}};
+    TopDownNode *great, *grand, *parent, *q;
+    int dir = 0, last = 0, inserted = 0;
+
+    if (!tree) return FAILED;
+
+    great = &head;
+    grand = parent = NULL;
+    q = head.link[1] = tree->root;
+
+    for (;;) {
+        if (!q) {
+            q = createTopDownNode(x);
+            if (!q) break;
+            if (parent) parent->link[dir] = q;
+            else head.link[1] = q;
+            inserted = 1;
+        } else if (TopDownIsRed(q->link[0]) && TopDownIsRed(q->link[1])) {
+            /* 颜色翻转, 把黑色下推给两个孩子 */
+            q->color = RED;
+            q->link[0]->color = BLACK;
+            q->link[1]->color = BLACK;
+        }
+
+        /* q与父结点连续红色, 父结点不是根结点, 祖父结点存在 */
+        if (TopDownIsRed(q) && TopDownIsRed(parent)) {
+            int side = great->link[1] == grand;
+
+            if (q == parent->link[last]) great->link[side] = singleRotate(grand, !last);
+            else great->link[side] = doubleRotate(grand, !last);
+        }
+
+        if (q->data == x) break;
+
+        last = dir;
+        dir = q->data < x;
+        if (grand) great = grand;
+        grand = parent;
+        parent = q;
+        q = q->link[dir];
+    }
+
+    tree->root = head.link[1];
+    if (tree->root) tree->root->color = BLACK;
+    if (inserted) tree->count++;
+
+    return inserted ? SUCCESS : FAILED;
+}
+
+/**
+ * 自顶向下单趟删除: 下降途中保证当前结点或其孩子为红色, 到达底部时
+ * 删除的总是红色结点或带一个红色孩子的结点, 无需回溯修复
+ *
+ * @param[in]  tree: the tree
+ * @param[in]  x   : the key
+ * @return  the operation status, SUCCESS is 0, FAILED is -1 if x is not found
+ */
+Status deleteTopDownRBTree(TopDownRBTree *tree, RBTreeElemType x)
+{
+    TopDownNode head = {0, BLACK, {NULL, NULL}};
+    TopDownNode *grand, *parent, *q, *found = NULL;
+    int dir = 1;
+
+    if (!tree || !tree->root) return FAILED;
+
+    q = &head;
+    grand = parent = NULL;
+    head.link[1] = tree->root;
+
+    /* 找到x后继续走向其前驱, q最终停在前驱结点(x没有左子树时即x本身) */
+    while (q->link[dir]) {
+        int last = dir;
+
+        grand = parent;
+        parent = q;
+        q = q->link[dir];
+        dir = q->data < x;
+        if (q->data == x) found = q;
+
+        if (TopDownIsRed(q) || TopDownIsRed(q->link[dir])) continue;
+
+        if (TopDownIsRed(q->link[!dir])) {
+            /* 红色的另一个孩子旋转上来, q变为红色 */
+            parent = parent->link[last] = singleRotate(q, dir);
+        } else {
+            TopDownNode *sibling = parent->link[!last];
+
+            if (!sibling) continue;
+            if (!TopDownIsRed(sibling->link[0]) && !TopDownIsRed(sibling->link[1])) {
+                /* 颜色翻转, 父结点的红色下推给q和兄弟结点 */
+                parent->color = BLACK;
+                sibling->color = RED;
+                q->color = RED;
+            } else {
+                int side = grand->link[1] == parent;
+
+                if (TopDownIsRed(sibling->link[last])) grand->link[side] = doubleRotate(parent, last);
+                else grand->link[side] = singleRotate(parent, last);
+
+                /* 旋转后重新着色, q为红色 */
+                q->color = grand->link[side]->color = RED;
+                grand->link[side]->link[0]->color = BLACK;
+                grand->link[side]->link[1]->color = BLACK;
+            }
+        }
+    }
+
+    if (found) {
+        found->data = q->data;
+        parent->link[parent->link[1] == q] = q->link[!q->link[0]];
+        free(q);
+        tree->count--;
+    }
+
+    tree->root = head.link[1];
+    if (tree->root) tree->root->color = BLACK;
+
+    return found ? SUCCESS : FAILED;
+}
+
+/**
+ * 迭代器定位到最小结点, 沿左链把路径压栈
+ *
+ * @param[in]  it  : the iterator
+ * @param[in]  tree: the tree
+ * @return  the operation status, SUCCESS is 0, FAILED is -1 if the tree is empty
+ */
+Status firstTopDownRBTreeIterator(TopDownRBTreeIterator *it, TopDownRBTree *tree)
+{
+    TopDownNode *p;
+
+    if (!it) return FAILED;
+
+    it->top = 0;
+    for (p = tree ? tree->root : NULL; p; p = p->link[0]) it->stack[it->top++] = p;
+
+    return it->top ? SUCCESS : FAILED;
+}
+
+/**
+ * 迭代器定位到第一个不小于x的结点, 只压入下降时向左走的结点
+ *
+ * @param[in]  it  : the iterator
+ * @param[in]  tree: the tree
+ * @param[in]  x   : the lower bound
+ * @return  the operation status, SUCCESS is 0, FAILED is -1 if all keys are less than x
+ */
+Status seekTopDownRBTreeIterator(TopDownRBTreeIterator *it, TopDownRBTree *tree, RBTreeElemType x)
+{
+    TopDownNode *p = tree ? tree->root : NULL;
+
+    if (!it) return FAILED;
+
+    it->top = 0;
+    while (p) {
+        if (p->data < x) p = p->link[1];
+        else {
+            it->stack[it->top++] = p;
+            p = p->link[0];
+        }
+    }
+
+    return it->top ? SUCCESS : FAILED;
+}
+
+/**
+ * 迭代器移动到后继结点: 弹出当前结点, 再把其右子树的左链压栈
+ *
+ * @param[in]  it: the iterator
+ * @return  the operation status, SUCCESS is 0, FAILED is -1 if there is no successor
+ */
+Status nextTopDownRBTreeIterator(TopDownRBTreeIterator *it)
+{
+    TopDownNode *p;
+
+    if (!it || !it->top) return FAILED;
+
+    for (p = it->stack[--it->top]->link[1]; p; p = p->link[0]) it->stack[it->top++] = p;
+
+    return it->top ? SUCCESS : FAILED;
+}
@@ -1,7 +1,7 @@
 /**
  * @filename main.c
  * @description Red-Black Tree test
- * @author Ԫ
+ * @author 许继元
  * @date 2020/12/18
  */
 
@@ -30,145 +30,146 @@ void main()
 }
 
 /**
- * û˵
+ * 用户操作菜单
  *
  * @param[in]  root: the root of the red-black tree
  * @return  none
  */
 _Noreturn void menu(RBRoot *root)
 {
-    int exist_flag = 0;  /* ǺǷ */
+    int exist_flag = 0;  /* 标记红黑树是否存在 */
     while (true) {
         system("cls");
         printf("***********************************************************\n");
-        printf("**                                                 **\n");
-        printf("**                    : Ԫ                     **\n");
-        printf("**                   ѧ: 3119004757                    **\n");
-        printf("**              ༶: ѧ뼼(1)              **\n");
-        printf("**              ϵ: giyn.jy@gmail.com              **\n");
+        printf("**                        红黑树                         **\n");
+        printf("**                    开发者: 许继元                     **\n");
+        printf("**                   学号: 3119004757                    **\n");
+        printf("**              班级: 计算机科学与技术(1)班              **\n");
+        printf("**              联系邮箱: giyn.jy@gmail.com              **\n");
         printf("***********************************************************\n");
         printf("-----------------------------------------------------------\n");
-        printf(">>> 1.ʼ     7.ָ(1-2020) <<<\n");
-        printf(">>> 2.ӡϢ   8.ǰ                       <<<\n");
-        printf(">>> 3.ٺ       9.                       <<<\n");
-        printf(">>> 4.ɾ        10.                       <<<\n");
-        printf(">>> 5.        11.С             <<<\n");
-        printf(">>> 6.ҽ        12.˳                           <<<\n");
+        printf(">>> 1.初始化红黑树     7.插入指定数量的随机(1-2020)结点 <<<\n");
+        printf(">>> 2.打印红黑树信息   8.前序遍历                       <<<\n");
+        printf(">>> 3.销毁红黑树       9.中序遍历                       <<<\n");
+        printf(">>> 4.删除结点        10.后序遍历                       <<<\n");
+        printf(">>> 5.插入结点        11.查找最大和最小结点             <<<\n");
+        printf(">>> 6.查找结点        12.退出                           <<<\n");
         printf("-----------------------------------------------------------\n");
         if(exist_flag) {
-            /* ԰뷨ķʽʵʱӡ */
+            /* 以凹入法的方式实时打印红黑树 */
             recessedPrintRBTree(root->node, 0);
-            if (!root->node) printf("Ϊ!\n");
-        } else printf("ں!\n");
+            if (!root->node) printf("红黑树为空!\n");
+        } else printf("不存在红黑树!\n");
         printf("-----------------------------------------------------------\n");
-        printf(">>> ִеĲ:");
+        printf(">>> 请输入你想执行的操作:");
 
         switch (InputInteger()) {
-            case 1:  /* ʼ */
+            case 1:  /* 初始化 */
                 root = createRBTree();
                 exist_flag = 1;
-                printf("ʼɹ!\n");
+                printf("初始化红黑树成功!\n");
                 break;
-            case 2:  /* ӡ */
+            case 2:  /* 打印 */
                 if (exist_flag) printRBTree(root);
-                else printf("ں, ȳʼ!\n");
+                else printf("不存在红黑树, 请先初始化!\n");
                 break;
-            case 3:  /*  */
+            case 3:  /* 销毁 */
                 if (exist_flag) {
                     destroyRBTree(root);
                     exist_flag = 0;
-                    printf("ٺɹ!\n");
-                } else printf("ں, ȳʼ!\n");
+                    printf("销毁红黑树成功!\n");
+                } else printf("不存在红黑树, 请先初始化!\n");
                 break;
-            case 4:  /* ɾ */
+            case 4:  /* 删除 */
                 if (exist_flag) {
                     int delete_x;
                     Status delete_status;
                     double cost;
-                    printf("ɾĽ:");
+                    printf("请输入你想删除的结点:");
                     delete_x = InputInteger();
                     beginRecord();
                     delete_status = deleteRBTree(root, delete_x);
                     cost = endRecord();
-                    if (delete_status == SUCCESS) printf("ɾɹ!\nɾķʱ: %lf ms.\n", cost);
-                    else printf("ɾʧ, ڸý!\n");
-                } else printf("ں, ȳʼ!\n");
+                    if (delete_status == SUCCESS) printf("删除结点成功!\n删除耗费时间: %lf ms.\n", cost);
+                    else printf("删除结点失败, 不存在该结点!\n");
+                } else printf("不存在红黑树, 请先初始化!\n");
                 break;
-            case 5:  /*  */
+            case 5:  /* 插入 */
                 if (exist_flag){
                     int insert_x;
                     Status insert_status;
                     double cost;
-                    printf("Ľ:");
+                    printf("请输入你想插入的结点:");
                     insert_x = InputInteger();
                     beginRecord();
                     insert_status = insertRBTree(root, insert_x);
                     cost = endRecord();
-                    if (insert_status == SUCCESS) printf("ɹ!\nķʱ: %lf ms.\n", cost);
-                    else printf("ʧ, ýѴ!\n");
-                } else printf("ں, ȳʼ!\n");
+                    if (insert_status == SUCCESS) printf("插入结点成功!\n插入耗费时间: %lf ms.\n", cost);
+                    else printf("插入结点失败, 该结点已存在!\n");
+                } else printf("不存在红黑树, 请先初始化!\n");
                 break;
-            case 6:  /*  */
+            case 6:  /* 查找 */
                 if (exist_flag) {
                     int search_x;
-                    printf("ҵĽ:");
+                    printf("请输入你想查找的结点:");
                     search_x = InputInteger();
-                    if ((recursiveSearchRBTree(root, search_x)) == SUCCESS) printf("ҳɹ, ڸý!\n");
-                    else printf("ʧ, ڸý!\n");
-                } else printf("ں, ȳʼ!\n");
+                    if ((recursiveSearchRBTree(root, search_x)) == SUCCESS) printf("查找成功, 存在该结点!\n");
+                    else printf("查找失败, 不存在该结点!\n");
+                } else printf("不存在红黑树, 请先初始化!\n");
                 break;
-            case 7:  /* ָĽ */
+            case 7:  /* 随机插入指定数量的结点 */
                 if (exist_flag) {
-                    /*  */
+                    /* 设置随机数种子 */
                     srand((unsigned int) time(NULL));
-                    printf("Ľ:");
+                    printf("请输入你想插入的结点数量:");
                     int i, length_of_array;
                     length_of_array = InputInteger();
-                    /* Աʾ鳤 */
+                    /* 以变量表示数组长度 */
                     int *const array = (int *) malloc(sizeof(int) * length_of_array);
-                    /* Ԫλ1-2020 */
+                    /* 生成元素位于1-2020的数组 */
                     for (i = 0; i < length_of_array; i++) array[i] = rand() % 2020;
-                    printf("ĽΪ: ");
-                    for (i = 0; i < length_of_array; i++) {
-                        printf("%d ", array[i]);
-                        insertRBTree(root, array[i]);
-                    }
-                    printf("\nɹ!\n");
-                } else printf("ں, ȳʼ!\n");
+                    printf("插入的结点为: ");
+                    for (i = 0; i < length_of_array; i++) printf("%d ", array[i]);
+                    /* 空树直接批量构建, 否则逐个插入 */
+                    if (!root->node) buildRBTree(root, array, length_of_array);
+                    else for (i = 0; i < length_of_array; i++) insertRBTree(root, array[i]);
+                    free(array);
+                    printf("\n插入结点成功!\n");
+                } else printf("不存在红黑树, 请先初始化!\n");
                 break;
-            case 8:  /* ǰ */
+            case 8:  /* 前序遍历 */
                 if (exist_flag) {
                     preorderRBTree(root);
                     printf("\n");
-                } else printf("ں, ȳʼ!\n");
+                } else printf("不存在红黑树, 请先初始化!\n");
                 break;
-            case 9:  /*  */
+            case 9:  /* 中序遍历 */
                 if (exist_flag) {
                     inorderRBTree(root);
                     printf("\n");
-                } else printf("ں, ȳʼ!\n");
+                } else printf("不存在红黑树, 请先初始化!\n");
                 break;
-            case 10:  /*  */
+            case 10:  /* 后序遍历 */
                 if (exist_flag) {
                     postorderRBTree(root);
                     printf("\n");
-                } else printf("ں, ȳʼ!\n");
+                } else printf("不存在红黑树, 请先初始化!\n");
                 break;
-            case 11:  /* С */
+            case 11:  /* 查找最大和最小结点 */
                 if (exist_flag && root->node) {
                     RBTreeElemType *max = (RBTreeElemType *)malloc(sizeof(int));
                     RBTreeElemType *min = (RBTreeElemType *)malloc(sizeof(int));
                     maxRBTreeNode(root, max);
                     minRBTreeNode(root, min);
-                    printf("Ϊ[%d], СΪ[%d]!\n", *max, *min);
-                } else if (!root->node) printf("Ϊ!\n");
-                else printf("ں, ȳʼ!\n");
+                    printf("红黑树最大结点为[%d], 最小结点为[%d]!\n", *max, *min);
+                } else if (!root->node) printf("红黑树为空!\n");
+                else printf("不存在红黑树, 请先初始化!\n");
                 break;
-            case 12:  /* ˳ */
+            case 12:  /* 退出程序 */
                 printf("Bye!");
                 exit(0);
             default:
-                printf("ڸѡ, !\n");
+                printf("不存在该选项, 请重新输入!\n");
                 break;
         }
         system("pause");
@@ -176,7 +177,7 @@ _Noreturn void menu(RBRoot *root)
 }
 
 /**
- * û
+ * 检测用户整数输入
  *
  * @param[in]  none
  * @return  legal integer
@@ -203,7 +204,7 @@ int InputInteger()
             }
         }
         if (status == FALSE) {
-            printf("Ƿ, :");
+            printf("输入非法, 请重新输入:");
             continue;
         } else {
             /* Convert string to number */
@@ -223,7 +224,7 @@ int InputInteger()
 
             /* check if the number entered is out of bounds */
             if (i >= 10) {
-                printf(", :");
+                printf("溢出, 请重新输入:");
                 status = FALSE;
             }
         }
@@ -233,7 +234,7 @@ int InputInteger()
 }
 
 /**
- * ʼ¼
+ * 开始记录
  *
  * @param[in]  none
  * @return  none
@@ -244,7 +245,7 @@ void beginRecord() {
 }
 
 /**
- * ֹͣ¼
+ * 停止记录
  *
  * @param[in]  none
  * @return  execution time of the program